@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AreaBoundaryPredictorComponent.h"
 #include "AreaMeshComponent.h"
 #include "AreaMeshGeneratorComponent.h"
 #include "ReplicatedAreaBoundaryComponent.h"
@@ -32,10 +33,28 @@ public:
 	UPROPERTY()
 	UAreaMeshComponent* ClientAreaMesh;
 
+	/**
+	 * 클라이언트에서 화면에 보여주는 경계, 로컬 플레이어의 확장이 서버보다 먼저 적용되어 있을 수 있음
+	 */
+	UPROPERTY()
+	UAreaBoundaryComponent* ClientPredictedAreaBoundary;
+
+	/**
+	 * 클라이언트에서 이 액터가 플레이어 머신 컴포넌트를 붙일 때 생기므로 폰이 먼저 준비됐으면 생길 때까지 기다려야 함
+	 */
+	TLiveDataView<UAreaBoundaryPredictorComponent*&> GetClientAreaBoundaryPredictor() const
+	{
+		return ClientAreaBoundaryPredictor;
+	}
+
 	DECLARE_LIVE_DATA_GETTER_SETTER(AreaBaseColor);
 	DECLARE_LIVE_DATA_GETTER_SETTER(ServerCalculatedArea);
 
 private:
+	UPROPERTY()
+	UAreaBoundaryPredictorComponent* ClientAreaBoundaryPredictorPtr;
+	TLiveData<UAreaBoundaryPredictorComponent*&> ClientAreaBoundaryPredictor{ClientAreaBoundaryPredictorPtr};
+
 	UPROPERTY(ReplicatedUsing=OnRep_AreaBaseColor)
 	FLinearColor RepAreaBaseColor;
 	TLiveData<FLinearColor&> AreaBaseColor{RepAreaBaseColor};
@@ -127,6 +146,21 @@ private:
 		// 클래스 서버 코드에서 뭔가 실수한 거임 고쳐야 됨
 		check(AreaBoundaryProvider);
 
+		// 클라이언트에서는 서버의 경계를 예측용 경계에 옮겨서 보여줌, 로컬 플레이어가 확장을 예측하지 않으면 서버의 경계와 같음
+		if (GetNetMode() == NM_Client)
+		{
+			ClientPredictedAreaBoundary = NewObject<UAreaBoundaryComponent>(this);
+			ClientPredictedAreaBoundary->RegisterComponent();
+
+			auto Predictor = NewObject<UAreaBoundaryPredictorComponent>(this);
+			Predictor->SetAuthoritativeBoundary(AreaBoundaryProvider);
+			Predictor->SetPredictedBoundary(ClientPredictedAreaBoundary);
+			Predictor->RegisterComponent();
+			ClientAreaBoundaryPredictor = Predictor;
+
+			AreaBoundaryProvider = ClientPredictedAreaBoundary;
+		}
+
 		auto AreaMeshGenerator = NewObject<UAreaMeshGeneratorComponent>(this);
 		AreaMeshGenerator->SetMeshSource(AreaBoundaryProvider);
 		AreaMeshGenerator->SetMeshDestination(ClientAreaMesh);
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "AreaBoundaryProvider.h"
+#include "AreaRandomPointSampler.h"
 #include "PaperUnreal/GameFramework2/ActorComponent2.h"
 #include "PaperUnreal/WeakCoroutine/CoroutineMutex.h"
 #include "PaperUnreal/WeakCoroutine/WeakCoroutine.h"
@@ -25,9 +26,19 @@ public:
 
 	void Reset()
 	{
+		RandomPointSampler.Reset();
 		AreaBoundary.SetValueNoComparison(FLoopedSegmentArray2D{});
 	}
 
+	/**
+	 * 경계를 통째로 바꿉니다. 클라이언트에서 예측한 경계를 서버의 경계에 맞출 때 사용합니다.
+	 */
+	void SetBoundary(FLoopedSegmentArray2D NewBoundary)
+	{
+		RandomPointSampler.Reset();
+		AreaBoundary.SetValueNoComparison(MoveTemp(NewBoundary));
+	}
+
 	void ResetToStartingBoundary(const FVector& Location)
 	{
 		const TArray<FVector2D> VertexPositions = [&]()
@@ -41,9 +52,34 @@ public:
 			return Ret;
 		}();
 
+		RandomPointSampler.Reset();
 		AreaBoundary.SetValueNoComparison(VertexPositions);
 	}
 
+	/**
+	 * 영역이 확장되거나 축소되어 점이 충분히 늘어났을 때 경계에서 필요 없는 점들을 제거하는 기준을 설정합니다.
+	 * FLoopedSegmentArray2D::Simplify 참고
+	 *
+	 * 단순화는 경계 전체를 훑고 경계에 저장해둔 것들을 모두 버리므로 매번 하지 않고
+	 * 마지막으로 단순화한 이후 점의 개수가 일정 비율 이상 늘어났을 때만 합니다. 그 사이에는 MaxPointCount를 잠시 넘을 수 있음
+	 * 단순화로 경계가 움직여서 경계 위에서 출발한 트레이서가 경계 밖에 떨어져도 MaxError 이내면 확장할 때 경계에 이어붙임
+	 *
+	 * @param MaxError 0 이하면 MaxPointCount를 넘지 않는 한 단순화하지 않음
+	 */
+	void SetSimplificationSettings(float MaxError, int32 MaxPointCount = 0)
+	{
+		SimplificationMaxError = MaxError;
+		SimplificationMaxPointCount = MaxPointCount;
+	}
+
+	/**
+	 * 지금까지 단순화로 제거한 점의 총 개수
+	 */
+	int32 GetSimplifiedPointCount() const
+	{
+		return SimplifiedPointCount;
+	}
+
 	using FExpansionResult = FUnionResult;
 
 	template <CSegmentArray2D SegmentArrayType>
@@ -59,11 +95,32 @@ public:
 		{
 			AreaBoundary.Modify([&](FLoopedSegmentArray2D& Boundary)
 			{
-				return Boundary.Difference(Forward<SegmentArrayType>(Path));
+				const bool bReduced = Boundary.Difference(Forward<SegmentArrayType>(Path));
+				if (bReduced)
+				{
+					RandomPointSampler.Reset();
+					SimplifyIfGrown(Boundary);
+				}
+				return bReduced;
 			});
 		}
 	}
 
+	/**
+	 * 경계의 사본에 Difference를 적용한 결과로 경계를 바꿉니다.
+	 * ReduceByPath와 같지만 Difference를 게임 스레드 밖에서 미리 계산해둔 경우에 사용합니다.
+	 */
+	void SetReducedBoundary(FLoopedSegmentArray2D ReducedBoundary)
+	{
+		AreaBoundary.Modify([&](FLoopedSegmentArray2D& Boundary)
+		{
+			Boundary = MoveTemp(ReducedBoundary);
+			RandomPointSampler.Reset();
+			SimplifyIfGrown(Boundary);
+			return true;
+		});
+	}
+
 	bool IsInside(const FVector& Point) const
 	{
 		return AreaBoundary.Get().IsInside(FVector2D{Point});
@@ -78,28 +135,26 @@ public:
 		return false;
 	}
 
-	FVector GetRandomPointInside() const
+	/**
+	 * 영역 안의 점을 넓이에 대해 균일한 확률로 하나 골라서 반환합니다.
+	 * 처음 호출될 때 영역을 삼각형으로 나눠두고 경계가 바뀔 때까지 재사용하므로 O(log n)입니다.
+	 *
+	 * @param MinDistanceFromEdge 경계에서 이만큼 떨어진 점을 고르려고 시도함 (영역이 좁아서 찾지 못하면 경계에서 가장 먼 후보를 반환)
+	 */
+	FVector GetRandomPointInside(float MinDistanceFromEdge = 0.f) const
 	{
-		// 그냥 적당히 좋은 구현
-		// 영역의 바운딩 박스를 가로 세로 10등분해서 랜덤 셀을 하나 고른다음에
-		// 그 중심이 영역 안에 있으면 그걸 반환 아니면 거기서 가장 가까운 영역 내 위치 반환
-
-		const FBox2D BoundingBox = AreaBoundary.Get().CalculateBoundingBox();
-		const float CellWidth = BoundingBox.GetSize().X;
-		const float CellHeight = BoundingBox.GetSize().Y;
-		const int32 CellX = FMath::RandRange(0, 9);
-		const int32 CellY = FMath::RandRange(0, 9);
-		const float X = BoundingBox.Min.X + CellWidth / 2.f + CellWidth * CellX;
-		const float Y = BoundingBox.Min.Y + CellHeight / 2.f + CellHeight * CellY;
-
-		const FVector2D RandomCellCenter{X, Y};
+		if (!RandomPointSampler)
+		{
+			RandomPointSampler.Emplace(AreaBoundary.Get());
+		}
 
-		if (AreaBoundary.Get().IsInside(RandomCellCenter))
+		if (!RandomPointSampler->IsValid())
 		{
-			return FVector{RandomCellCenter, GetOwner()->GetActorLocation().Z};
+			return GetOwner()->GetActorLocation();
 		}
 
-		return FVector{FindClosestPointOnBoundary2D(RandomCellCenter).GetPoint(), GetOwner()->GetActorLocation().Z};
+		const FVector2D Point = RandomPointSampler->Sample(AreaBoundary.Get(), MinDistanceFromEdge);
+		return FVector{Point, GetOwner()->GetActorLocation().Z};
 	}
 
 	struct FPointOnBoundary
@@ -147,6 +202,47 @@ public:
 private:
 	TLiveData<FLoopedSegmentArray2D> AreaBoundary;
 
+	/**
+	 * GetRandomPointInside에서 처음 필요할 때 만들고 경계를 수정하는 함수들에서 버림
+	 * (관찰자가 알림을 받기 전에 버려야 알림 안에서 GetRandomPointInside를 불러도 새 경계로 뽑음)
+	 */
+	mutable TOptional<FAreaRandomPointSampler> RandomPointSampler;
+
+	// Union으로 트레이서의 점들이 전부 경계에 들어오므로 1cm 안쪽으로 거의 일직선인 점들은 지워도 모양에 차이가 없음
+	float SimplificationMaxError = 1.f;
+	int32 SimplificationMaxPointCount = 0;
+	int32 SimplifiedPointCount = 0;
+
+	/**
+	 * 마지막으로 단순화한 직후의 점의 개수, 경계가 이보다 작아지면 작아진 개수로 낮춤
+	 */
+	int32 PointCountAtLastSimplification = 0;
+
+	/**
+	 * 점이 이 개수와 PointCountAtLastSimplification의 1/4 중 큰 쪽 이상 늘어나야 다시 단순화함
+	 * 비율로 기다리므로 단순화 비용은 추가된 점 하나당 상수 시간으로 나눠짐
+	 */
+	static constexpr int32 SimplificationMinAddedPointCount = 32;
+
+	void SimplifyIfGrown(FLoopedSegmentArray2D& Boundary)
+	{
+		PointCountAtLastSimplification = FMath::Min(PointCountAtLastSimplification, Boundary.PointCount());
+
+		if (SimplificationMaxError <= 0.f && SimplificationMaxPointCount <= 0)
+		{
+			return;
+		}
+
+		const int32 AddedPointCount = Boundary.PointCount() - PointCountAtLastSimplification;
+		if (AddedPointCount < FMath::Max(SimplificationMinAddedPointCount, PointCountAtLastSimplification / 4))
+		{
+			return;
+		}
+
+		SimplifiedPointCount += Boundary.Simplify(SimplificationMaxError, SimplificationMaxPointCount);
+		PointCountAtLastSimplification = Boundary.PointCount();
+	}
+
 	TWeakCoroutine<TArray<FExpansionResult>> ExpandByPathLocked(FSegmentArray2D Path)
 	{
 		if (!Path.IsValid())
@@ -160,8 +256,15 @@ private:
 		TArray<FExpansionResult> Ret;
 		AreaBoundary.ModifyAssumeLocked([&](FLoopedSegmentArray2D& Boundary)
 		{
+			// 트레이서가 경계를 떠난 뒤에 단순화가 일어났으면 트레이서의 양 끝이 경계 밖으로 최대 SimplificationMaxError만큼 떨어져 있을 수 있음
+			Boundary.AttachPathEnds(Path, SimplificationMaxError);
 			Ret = Boundary.Union(MoveTemp(Path));
 			const bool bNotify = Ret.Num() > 0;
+			if (bNotify)
+			{
+				RandomPointSampler.Reset();
+				SimplifyIfGrown(Boundary);
+			}
 			return bNotify;
 		});
 		co_return Ret;
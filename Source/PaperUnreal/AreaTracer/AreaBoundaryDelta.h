@@ -0,0 +1,163 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+ * 영역 경계의 이전 점 배열을 새 점 배열로 바꾸는 편집 내역
+ *
+ * Union이나 Difference는 경계의 일부 구간만 ReplacePoints나 InsertPoints로 교체하므로 바뀌지 않은 점들이 대부분입니다.
+ * 이전 배열에도 있는 점들은 보내지 않고 그 사이에 끼어든 새 점들만 Splice로 기록해서 네트워크로 전체 배열을 보내지 않도록 합니다.
+ *
+ * 루프 경계는 배열의 끝과 처음에 걸친 구간을 교체하면 남은 점들이 맨 앞으로 밀려나므로
+ * 이전 배열을 먼저 Rotation만큼 회전시킨 다음 Splice들을 앞에서부터 차례로 적용합니다.
+ */
+struct FAreaBoundaryDelta
+{
+	struct FSplice
+	{
+		/**
+		 * 앞의 Splice들까지 적용한 배열에서 교체를 시작할 위치 (Splice들은 항상 이 값의 오름차순으로 정렬되어 있음)
+		 */
+		int32 Index = 0;
+		int32 RemoveCount = 0;
+		TArray<FVector2D> Points;
+	};
+
+	int32 Rotation = 0;
+	TArray<FSplice> Splices;
+
+	/**
+	 * Old를 New로 만드는 편집 내역을 계산합니다.
+	 * 두 배열에 모두 있는 점은 좌표가 정확히 같을 때만 같은 점으로 취급하며 순서가 뒤바뀐 점들은 새 점으로 보냄
+	 */
+	static FAreaBoundaryDelta Make(TArrayView<const FVector2D> Old, TArrayView<const FVector2D> New)
+	{
+		FAreaBoundaryDelta Ret;
+
+		TMap<FVector2D, int32> OldIndices;
+		for (int32 i = 0; i < Old.Num(); i++)
+		{
+			if (!OldIndices.Find(Old[i]))
+			{
+				OldIndices.Add(Old[i], i);
+			}
+		}
+
+		const auto FindOldIndex = [&](int32 NewIndex) -> int32
+		{
+			const int32* Found = OldIndices.Find(New[NewIndex]);
+			return Found ? *Found : INDEX_NONE;
+		};
+
+		// 새 배열에서 처음으로 남아있는 점이 회전시킨 배열의 맨 앞에 오도록 함
+		for (int32 i = 0; i < New.Num(); i++)
+		{
+			const int32 OldIndex = FindOldIndex(i);
+			if (OldIndex != INDEX_NONE)
+			{
+				Ret.Rotation = OldIndex;
+				break;
+			}
+		}
+
+		// OldCursor 앞의 점들은 처리가 끝났고 NewPoints[FirstPending, i)는 아직 Splice로 만들지 않은 새 점들
+		int32 OldCursor = 0;
+		int32 FirstPending = 0;
+		const auto AddSplice = [&](int32 NextKept, int32 End)
+		{
+			if (NextKept > OldCursor || End > FirstPending)
+			{
+				FSplice& Splice = Ret.Splices.AddDefaulted_GetRef();
+				Splice.Index = FirstPending;
+				Splice.RemoveCount = NextKept - OldCursor;
+				Splice.Points.Append(New.GetData() + FirstPending, End - FirstPending);
+			}
+		};
+
+		for (int32 i = 0; i < New.Num(); i++)
+		{
+			const int32 OldIndex = FindOldIndex(i);
+			if (OldIndex == INDEX_NONE)
+			{
+				continue;
+			}
+
+			const int32 Rotated = (OldIndex - Ret.Rotation + Old.Num()) % Old.Num();
+			if (Rotated < OldCursor)
+			{
+				continue;
+			}
+
+			AddSplice(Rotated, i);
+			OldCursor = Rotated + 1;
+			FirstPending = i + 1;
+		}
+
+		AddSplice(Old.Num(), New.Num());
+
+		return Ret;
+	}
+
+	bool IsEmpty() const
+	{
+		return Rotation == 0 && Splices.IsEmpty();
+	}
+
+	/**
+	 * 편집 내역에 담긴 새 점의 개수
+	 */
+	int32 GetPointCount() const
+	{
+		int32 Ret = 0;
+		for (const FSplice& Each : Splices)
+		{
+			Ret += Each.Points.Num();
+		}
+		return Ret;
+	}
+
+	/**
+	 * Make에 넘긴 Old와 같은 배열에 적용하면 New와 같은 배열을 반환합니다.
+	 * 편집 내역은 네트워크로 받은 값이므로 Old에 적용할 수 없는 내역이면 (어긋난 배열에 적용했거나 잘못된 패킷) 아무것도 반환하지 않음
+	 */
+	TOptional<TArray<FVector2D>> Apply(TArrayView<const FVector2D> Old) const
+	{
+		if (Rotation < 0 || (Rotation > 0 && Rotation >= Old.Num()))
+		{
+			return {};
+		}
+
+		TArray<FVector2D> Ret;
+		Ret.Reserve(Old.Num() + GetPointCount());
+
+		int32 OldCursor = 0;
+		const auto CopyOld = [&](int32 Count)
+		{
+			for (int32 i = 0; i < Count; i++)
+			{
+				Ret.Add(Old[(Rotation + OldCursor++) % Old.Num()]);
+			}
+		};
+
+		for (const FSplice& Each : Splices)
+		{
+			const int32 KeptCount = Each.Index - Ret.Num();
+			if (KeptCount < 0 || Each.RemoveCount < 0
+				|| KeptCount > Old.Num() - OldCursor || Each.RemoveCount > Old.Num() - OldCursor - KeptCount)
+			{
+				return {};
+			}
+
+			CopyOld(KeptCount);
+			OldCursor += Each.RemoveCount;
+			Ret.Append(Each.Points.GetData(), Each.Points.Num());
+		}
+
+		CopyOld(Old.Num() - OldCursor);
+
+		return Ret;
+	}
+};
@@ -0,0 +1,96 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AreaBoundaryComponent.h"
+#include "AreaBoundaryProvider.h"
+#include "AreaExpansionPredictor.h"
+#include "TracerToAreaConverterComponent.h"
+#include "PaperUnreal/WeakCoroutine/WeakCoroutine.h"
+#include "AreaBoundaryPredictorComponent.generated.h"
+
+
+/**
+ * 클라이언트에서 영역 확장을 미리 보여주는 컴포넌트
+ *
+ * 평소에는 서버에서 복제된 경계를 PredictedBoundary에 그대로 옮겨두고
+ * 로컬 트레이서가 PredictedBoundary를 확장하면 서버의 경계가 도착할 때까지 확장된 경계를 보여줍니다.
+ * 서버의 경계와 맞춰보는 방법은 FAreaExpansionPredictor 참고
+ */
+UCLASS()
+class UAreaBoundaryPredictorComponent : public UActorComponent2
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * 예측이 이 시간(초) 안에 서버의 경계와 같아지지 않으면 틀린 것으로 봄, RTT보다 충분히 커야 함
+	 */
+	static constexpr float PredictionTimeout = 1.f;
+
+	void SetAuthoritativeBoundary(IAreaBoundaryProvider* Provider)
+	{
+		check(!HasBeenInitialized());
+		AuthoritativeBoundary = Cast<UObject>(Provider);
+	}
+
+	void SetPredictedBoundary(UAreaBoundaryComponent* Boundary)
+	{
+		check(!HasBeenInitialized());
+		PredictedBoundary = Boundary;
+	}
+
+	/**
+	 * Converter가 PredictedBoundary를 확장할 때마다 예측으로 기록합니다.
+	 */
+	void AddPredictionSource(UTracerToAreaConverterComponent* Converter)
+	{
+		check(Converter->GetArea() == PredictedBoundary);
+
+		Converter->OnTracerToAreaConversion.AddWeakLambda(this, [this](const FSegmentArray2D& Path)
+		{
+			Predictor.AddPrediction(Path, GetWorld()->GetTimeSeconds() + PredictionTimeout);
+
+			RunWeakCoroutine(this, [this]() -> FWeakCoroutine
+			{
+				co_await WaitForSeconds(GetWorld(), PredictionTimeout);
+
+				if (Predictor.Expire(GetWorld()->GetTimeSeconds()))
+				{
+					PredictedBoundary->SetBoundary(Predictor.GetAuthoritative());
+				}
+			});
+		});
+	}
+
+	int32 GetPredictionHitCount() const { return Predictor.GetHitCount(); }
+	int32 GetPredictionMissCount() const { return Predictor.GetMissCount(); }
+
+private:
+	UPROPERTY()
+	TScriptInterface<IAreaBoundaryProvider> AuthoritativeBoundary;
+
+	UPROPERTY()
+	UAreaBoundaryComponent* PredictedBoundary;
+
+	FAreaExpansionPredictor Predictor;
+
+	UAreaBoundaryPredictorComponent()
+	{
+		bWantsInitializeComponent = true;
+	}
+
+	virtual void InitializeComponent() override
+	{
+		Super::InitializeComponent();
+
+		AddLifeDependency(Cast<UActorComponent2>(AuthoritativeBoundary.GetObject()));
+		AddLifeDependency(PredictedBoundary);
+
+		AuthoritativeBoundary->GetBoundary().Observe(this, [this](const FLoopedSegmentArray2D& Boundary)
+		{
+			PredictedBoundary->SetBoundary(Predictor.Reconcile(Boundary));
+		});
+	}
+};
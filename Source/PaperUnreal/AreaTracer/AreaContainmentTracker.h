@@ -0,0 +1,70 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SegmentArray.h"
+
+
+/**
+ * 움직이는 점이 영역 안에 있는지를 매번 IsInside로 처음부터 검사하지 않고 이전 결과를 이어서 사용하는 클래스
+ *
+ * 이전 위치에서 새 위치까지 이동한 Segment가 경계와 닿지 않으면 안팎이 바뀔 수 없으므로 이전 결과를 그대로 사용하고
+ * 경계와 닿거나 아주 가까이 지나간 경우에만 IsInside로 다시 검사합니다.
+ * 이동 Segment 검사는 경계의 공간 인덱스를 사용하므로 경계가 길어져도 한 번 갱신하는 비용이 거의 늘어나지 않습니다.
+ * 경계가 바뀌면 이전 결과를 사용할 수 없으므로 반드시 Invalidate를 호출해야 합니다.
+ */
+class FAreaContainmentTracker
+{
+public:
+	/**
+	 * 이전 결과를 버립니다. 다음 Update에서 IsInside로 다시 검사합니다.
+	 */
+	void Invalidate()
+	{
+		LastLocation.Reset();
+	}
+
+	/**
+	 * 점이 Location으로 이동했을 때 Boundary 안에 있는지를 반환합니다.
+	 *
+	 * @param Boundary 마지막 Invalidate 이후로 항상 같은 경계여야 함
+	 */
+	bool Update(const FLoopedSegmentArray2D& Boundary, const FVector2D& Location)
+	{
+		const bool bNeedsFullTest = !LastLocation
+			|| (*LastLocation != Location && Boundary.IsNear({*LastLocation, Location}, CrossingTolerance));
+
+		if (bNeedsFullTest)
+		{
+			bInside = Boundary.IsInside(Location);
+			FullTestCount++;
+		}
+
+		LastLocation = Location;
+		return bInside;
+	}
+
+	bool IsInside() const
+	{
+		return bInside;
+	}
+
+	/**
+	 * 지금까지 IsInside로 처음부터 검사한 횟수
+	 */
+	int32 GetFullTestCount() const
+	{
+		return FullTestCount;
+	}
+
+private:
+	/**
+	 * IsInside가 경계 근처에서 허용하는 오차보다 넉넉하게 잡아서 경계를 넘은 이동을 놓치지 않도록 함
+	 */
+	static constexpr double CrossingTolerance = 0.01;
+
+	TOptional<FVector2D> LastLocation;
+	bool bInside = false;
+	int32 FullTestCount = 0;
+};
@@ -0,0 +1,160 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SegmentArray.h"
+
+
+/**
+ * 클라이언트에서 미리 적용한 영역 확장들을 서버의 경계가 도착할 때마다 맞춰보는 클래스
+ *
+ * 서버의 경계가 도착하면 아직 맞춰보지 못한 예측들의 Path를 순서대로 서버의 경계 위에 Union으로 다시 적용해보고
+ * 다시 적용해도 늘어나는 넓이가 오차 안이고 Path의 가운데가 서버의 경계 안에 있으면 서버가 이미 그 확장을 적용한 것이므로 맞은 것으로 보고 지웁니다.
+ * Path의 끝이 서버의 경계에서 벗어나 Union이 실패해도 늘어나는 넓이는 0이므로 넓이만으로는 판정하지 않습니다.
+ * 넓이 전체가 아니라 Path가 늘리는 넓이만 비교하므로 그 사이에 다른 플레이어가 영역을 잘라내도 판정이 흔들리지 않으며
+ * 맞지 않은 예측들은 다시 적용한 결과를 그대로 보여주므로 잘라낸 것도 바로 보입니다.
+ * 만료 시간까지 맞지 않는 예측이 있으면 틀린 것으로 보고 모든 예측을 버린 다음 서버의 경계를 그대로 사용합니다.
+ */
+class FAreaExpansionPredictor
+{
+public:
+	/**
+	 * 클라이언트와 서버의 트레이서 위치가 약간 다르므로 예측할 때 늘어난 넓이의 이 비율까지는 서버가 적용한 것으로 봄
+	 */
+	static constexpr double RelativeAreaTolerance = 0.25;
+
+	/**
+	 * 아주 작은 확장은 비율로 비교하기 어려우므로 이 넓이(cm^2)까지는 서버가 적용한 것으로 봄
+	 */
+	static constexpr double AbsoluteAreaTolerance = 100.;
+
+	/**
+	 * 클라이언트와 서버의 트레이서 위치가 약간 다르므로 Path의 가운데가 서버의 경계 밖이어도 이 거리(cm)까지는 안에 있는 것으로 봄
+	 */
+	static constexpr double PathDistanceTolerance = 10.;
+
+	/**
+	 * @param Path 예측한 확장에 사용한 Path
+	 * @param ExpireTime 이 시간까지 서버의 경계에 이 확장이 적용되지 않으면 틀린 것으로 봄
+	 */
+	void AddPrediction(FSegmentArray2D Path, double ExpireTime)
+	{
+		// 지금 보여주고 있는 경계에 적용했을 때 늘어나는 넓이가 서버가 적용하지 않았을 때 늘어날 넓이의 기준
+		const double AreaBefore = Displayed.CalculateArea();
+		Displayed.Union(Path);
+		const double ExpansionArea = FMath::Max(Displayed.CalculateArea() - AreaBefore, 0.);
+
+		FPrediction& Prediction = Predictions.AddDefaulted_GetRef();
+		Prediction.PathMiddle = FindMiddle(Path);
+		Prediction.Path = MoveTemp(Path);
+		Prediction.Tolerance = FMath::Max(AbsoluteAreaTolerance, ExpansionArea * RelativeAreaTolerance);
+		Prediction.ExpireTime = ExpireTime;
+	}
+
+	/**
+	 * 새로 도착한 서버의 경계로 맞은 예측들을 지우고 화면에 보여줄 경계를 반환합니다.
+	 */
+	FLoopedSegmentArray2D Reconcile(const FLoopedSegmentArray2D& NewAuthoritative)
+	{
+		Authoritative = NewAuthoritative;
+		Displayed = Authoritative;
+
+		// 서버는 확장을 순서대로 적용하므로 앞의 예측이 맞지 않았으면 뒤의 예측도 아직 적용되지 않은 것임
+		int32 HitPredictionCount = 0;
+		for (int32 i = 0; i < Predictions.Num(); i++)
+		{
+			FLoopedSegmentArray2D Replayed = Displayed;
+			Replayed.Union(Predictions[i].Path);
+
+			const bool bAlreadyApplied = HitPredictionCount == i
+				&& Replayed.CalculateArea() - Displayed.CalculateArea() <= Predictions[i].Tolerance
+				&& IsCovered(Displayed, Predictions[i].PathMiddle);
+
+			if (bAlreadyApplied)
+			{
+				HitPredictionCount++;
+			}
+			else
+			{
+				Displayed = MoveTemp(Replayed);
+			}
+		}
+
+		HitCount += HitPredictionCount;
+		Predictions.RemoveAt(0, HitPredictionCount);
+		return Displayed;
+	}
+
+	/**
+	 * Now까지 맞지 않은 예측이 있으면 모든 예측을 버리고 true를 반환합니다. 이 경우 GetAuthoritative를 보여주면 됨
+	 */
+	bool Expire(double Now)
+	{
+		if (Predictions.IsEmpty() || Predictions[0].ExpireTime > Now)
+		{
+			return false;
+		}
+
+		MissCount++;
+		Predictions.Empty();
+		Displayed = Authoritative;
+		return true;
+	}
+
+	const FLoopedSegmentArray2D& GetAuthoritative() const { return Authoritative; }
+	int32 GetPendingCount() const { return Predictions.Num(); }
+	int32 GetHitCount() const { return HitCount; }
+	int32 GetMissCount() const { return MissCount; }
+
+private:
+	struct FPrediction
+	{
+		FSegmentArray2D Path;
+		FVector2D PathMiddle;
+		double Tolerance = 0.;
+		double ExpireTime = 0.;
+	};
+
+	TArray<FPrediction> Predictions;
+	FLoopedSegmentArray2D Authoritative;
+
+	/**
+	 * 서버의 경계에 맞지 않은 예측들을 모두 적용한 경계, 마지막으로 보여주라고 반환한 경계와 같음
+	 */
+	FLoopedSegmentArray2D Displayed;
+
+	int32 HitCount = 0;
+	int32 MissCount = 0;
+
+	/**
+	 * Path를 따라 전체 길이의 절반만큼 간 점, 경계 위에 있는 양 끝과 달리 확장된 영역의 안쪽에 있음
+	 */
+	static FVector2D FindMiddle(const FSegmentArray2D& Path)
+	{
+		double Length = 0.;
+		for (int32 i = 0; i < Path.SegmentCount(); i++)
+		{
+			Length += FMath::Sqrt(Path.GetRawSegment(i).SquaredLength());
+		}
+
+		double Remaining = Length * 0.5;
+		for (int32 i = 0; i < Path.SegmentCount(); i++)
+		{
+			const FRawSegment2D Segment = Path.GetRawSegment(i);
+			const double SegmentLength = FMath::Sqrt(Segment.SquaredLength());
+			if (Remaining <= SegmentLength && SegmentLength > 0.)
+			{
+				return Segment.PointBetween(Remaining / SegmentLength);
+			}
+			Remaining -= SegmentLength;
+		}
+		return Path.GetPoint(-1);
+	}
+
+	static bool IsCovered(const FLoopedSegmentArray2D& Boundary, const FVector2D& Point)
+	{
+		return Boundary.IsInside(Point)
+			|| Boundary.FindClosestPointWithin(Point, PathDistanceTolerance).IsSet();
+	}
+};
@@ -0,0 +1,107 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AreaInteractionSubsystem.h"
+
+#include "TracerToAreaConverterComponent.h"
+#include "Async/ParallelFor.h"
+
+
+void UAreaInteractionSubsystem::AddExpansionSource(UTracerToAreaConverterComponent* Converter)
+{
+	Converter->OnTracerToAreaConversion.AddWeakLambda(this, [this, Converter](const FSegmentArray2D& CorrectlyAlignedPath)
+	{
+		ResolveExpansion(Converter->GetArea(), CorrectlyAlignedPath);
+	});
+}
+
+void UAreaInteractionSubsystem::ResolveExpansion(UAreaBoundaryComponent* ExpandedArea, const FSegmentArray2D& CorrectlyAlignedPath)
+{
+	if (!IsValid(ExpandedArea) || !ExpandedArea->IsValid() || !CorrectlyAlignedPath.IsValid())
+	{
+		return;
+	}
+
+	// 워커 스레드들이 동시에 읽기만 하도록 캐시를 미리 만들어 둠
+	const FLoopedSegmentArray2D& Expanded = ExpandedArea->GetBoundary().Get();
+	Expanded.WarmCaches();
+
+	// 확장한 영역과 같은 방향으로 정렬된 Path를 뒤집으면 다른 영역을 잘라내는 방향이 됨
+	FSegmentArray2D SlashPath = CorrectlyAlignedPath;
+	SlashPath.ReverseVertexOrder();
+	SlashPath.WarmCaches();
+
+	const FBox2D ExpandedBounds = Expanded.CalculateBoundingBox();
+	const FBox2D PathBounds = SlashPath.CalculateBoundingBox();
+
+	struct FSlash
+	{
+		UAreaBoundaryComponent* Target;
+		FLoopedSegmentArray2D Boundary;
+		bool bMaybeSwallowed;
+		bool bMaybeReduced;
+		bool bSwallowed = false;
+		bool bReduced = false;
+	};
+
+	// Bounding Box만으로 영향이 없다고 확실한 영역은 여기서 거름
+	TArray<FSlash> Slashes;
+	for (UAreaBoundaryComponent* Each : Areas)
+	{
+		if (Each == ExpandedArea || !IsValid(Each) || !Each->IsValid())
+		{
+			continue;
+		}
+
+		const FLoopedSegmentArray2D& Boundary = Each->GetBoundary().Get();
+		const FBox2D Bounds = Boundary.CalculateBoundingBox();
+		const bool bMaybeSwallowed = ExpandedBounds.IsInside(Bounds);
+		const bool bMaybeReduced = PathBounds.Intersect(Bounds);
+
+		if (bMaybeSwallowed || bMaybeReduced)
+		{
+			// 사본은 점들을 공유하다가 잘라낼 때 복사되므로 여기서는 복사 비용이 거의 없음
+			Slashes.Add({
+				.Target = Each,
+				.Boundary = Boundary,
+				.bMaybeSwallowed = bMaybeSwallowed,
+				.bMaybeReduced = bMaybeReduced,
+			});
+		}
+	}
+
+	// 각 영역은 자기 사본만 수정하고 확장된 영역과 Path는 읽기만 하므로 서로 독립적임
+	ParallelFor(Slashes.Num(), [&](int32 i)
+	{
+		FSlash& Slash = Slashes[i];
+
+		if (Slash.bMaybeSwallowed && Expanded.IsInside(Slash.Boundary))
+		{
+			Slash.bSwallowed = true;
+			return;
+		}
+
+		if (Slash.bMaybeReduced)
+		{
+			Slash.bReduced = Slash.Boundary.Difference(FSegmentArray2D{SlashPath});
+		}
+	}, Slashes.Num() < 2);
+
+	// 경계가 바뀌면 옵저버들이 호출되므로 게임 스레드에서 등록 순서대로 적용함
+	for (FSlash& Each : Slashes)
+	{
+		if (!IsValid(Each.Target))
+		{
+			continue;
+		}
+
+		if (Each.bSwallowed)
+		{
+			Each.Target->Reset();
+		}
+		else if (Each.bReduced)
+		{
+			Each.Target->SetReducedBoundary(MoveTemp(Each.Boundary));
+		}
+	}
+}
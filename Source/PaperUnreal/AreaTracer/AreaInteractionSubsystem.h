@@ -0,0 +1,50 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AreaBoundaryComponent.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AreaInteractionSubsystem.generated.h"
+
+
+class UTracerToAreaConverterComponent;
+
+
+/**
+ * 어떤 영역이 트레이서로 확장되었을 때 다른 영역들이 입는 영향(잘려나가거나 통째로 먹히는 것)을 한 곳에서 처리하는 서브시스템
+ *
+ * 확장 하나를 한 번만 받아서 영역들을 Bounding Box로 먼저 걸러내고 남은 영역들만 검사합니다.
+ * 각 영역의 검사와 자르기는 그 영역의 사본에만 쓰므로 워커 스레드들에서 나눠 계산하고 결과는 게임 스레드에서 등록 순서대로 적용합니다.
+ */
+UCLASS()
+class UAreaInteractionSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * 다른 영역의 확장에 영향을 받을 영역을 등록합니다.
+	 */
+	void RegisterArea(UAreaBoundaryComponent* Area)
+	{
+		Areas.AddUnique(Area);
+	}
+
+	void UnregisterArea(UAreaBoundaryComponent* Area)
+	{
+		// 등록 순서가 곧 결과 적용 순서이므로 순서를 유지하며 제거함
+		Areas.Remove(Area);
+	}
+
+	/**
+	 * Converter가 영역을 확장할 때마다 다른 영역들에 영향을 적용합니다.
+	 */
+	void AddExpansionSource(UTracerToAreaConverterComponent* Converter);
+
+private:
+	UPROPERTY()
+	TArray<UAreaBoundaryComponent*> Areas;
+
+	void ResolveExpansion(UAreaBoundaryComponent* ExpandedArea, const FSegmentArray2D& CorrectlyAlignedPath);
+};
@@ -28,11 +28,16 @@ public:
 			return;
 		}
 
-		FLoopedSegmentArray2D LocalBoundary = LastSetWorldBoundary;
-		LocalBoundary.ApplyToEachPoint([&](FVector2D& Each) { Each = WorldToLocal2D(Each); });
+		// 경계는 복사해도 점들을 공유하므로 변환한 점들은 경계를 복사해서 고치지 않고 바로 새 배열에 만듬
+		TArray<FVector2D> LocalPoints;
+		LocalPoints.Reserve(LastSetWorldBoundary.PointCount());
+		for (const FVector2D& Each : LastSetWorldBoundary.GetPoints())
+		{
+			LocalPoints.Add(WorldToLocal2D(Each));
+		}
 
 		UE::Geometry::FPlanarPolygonMeshGenerator Generator;
-		Generator.Polygon = UE::Geometry::FPolygon2d{LocalBoundary.GetPoints()};
+		Generator.Polygon = UE::Geometry::FPolygon2d{LocalPoints};
 		Generator.Generate();
 		DynamicMeshComponent->GetMesh()->Copy(&Generator);
 		DynamicMeshComponent->NotifyMeshUpdated();
@@ -0,0 +1,130 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SegmentArray.h"
+#include "Algo/BinarySearch.h"
+#include "CompGeom/PolygonTriangulation.h"
+
+
+/**
+ * 영역 안의 점을 넓이에 대해 균일한 확률로 뽑아주는 클래스
+ *
+ * 만들 때 경계를 삼각형들로 나누고 삼각형 넓이의 누적합을 저장해둡니다.
+ * 점을 뽑을 때는 누적합에서 이분 탐색으로 넓이에 비례한 확률로 삼각형을 고른 다음 그 삼각형 안에서 균일하게 점을 고르므로 O(log n)입니다.
+ * 삼각형 분할은 O(n^2)이므로 경계가 바뀔 때마다 만들지 말고 점이 필요할 때 만들어서 경계가 다시 바뀔 때까지 재사용해야 합니다.
+ */
+class FAreaRandomPointSampler
+{
+public:
+	explicit FAreaRandomPointSampler(const FLoopedSegmentArray2D& Boundary)
+	{
+		if (!Boundary.IsValid())
+		{
+			return;
+		}
+
+		Vertices = Boundary.GetPoints();
+
+		TArray<UE::Geometry::FIndex3i> AllTriangles;
+		PolygonTriangulation::TriangulateSimplePolygon(Vertices, AllTriangles, false);
+
+		Triangles.Reserve(AllTriangles.Num());
+		CumulativeAreas.Reserve(AllTriangles.Num());
+		for (const UE::Geometry::FIndex3i& Each : AllTriangles)
+		{
+			const double Area = 0.5 * FMath::Abs(FVector2D::CrossProduct(
+				Vertices[Each.B] - Vertices[Each.A],
+				Vertices[Each.C] - Vertices[Each.A]));
+
+			// 넓이가 0인 삼각형은 뽑힐 일이 없으므로 처음부터 넣지 않음
+			if (Area > 0.)
+			{
+				TotalArea += Area;
+				Triangles.Add(Each);
+				CumulativeAreas.Add(TotalArea);
+			}
+		}
+	}
+
+	/**
+	 * 점을 뽑을 수 있는지 (넓이가 있는 영역으로 만들어졌는지) 여부를 반환합니다.
+	 */
+	bool IsValid() const
+	{
+		return !Triangles.IsEmpty();
+	}
+
+	/**
+	 * 영역 안의 점을 균일한 확률로 하나 뽑습니다.
+	 */
+	FVector2D Sample() const
+	{
+		check(IsValid());
+
+		const double Target = FMath::FRand() * TotalArea;
+		const int32 TriangleIndex = FMath::Min(Algo::UpperBound(CumulativeAreas, Target), Triangles.Num() - 1);
+		const UE::Geometry::FIndex3i& Triangle = Triangles[TriangleIndex];
+
+		// 평행사변형에서 균일하게 뽑은 다음 삼각형 밖의 절반은 반대편 절반으로 뒤집음
+		double U = FMath::FRand();
+		double V = FMath::FRand();
+		if (U + V > 1.)
+		{
+			U = 1. - U;
+			V = 1. - V;
+		}
+
+		const FVector2D& A = Vertices[Triangle.A];
+		return A + (Vertices[Triangle.B] - A) * U + (Vertices[Triangle.C] - A) * V;
+	}
+
+	/**
+	 * 경계에서 MinDistanceFromEdge 이상 떨어진 점을 뽑습니다.
+	 * 경계에 너무 가까운 점은 버리고 다시 뽑으며 MaxTries번 안에 찾지 못하면 지금까지 뽑은 점 중 경계에서 가장 먼 점을 반환합니다.
+	 *
+	 * @param Boundary 이 객체를 만들 때 사용한 경계
+	 */
+	FVector2D Sample(const FLoopedSegmentArray2D& Boundary, double MinDistanceFromEdge, int32 MaxTries = 16) const
+	{
+		FVector2D Ret = Sample();
+		if (MinDistanceFromEdge <= 0.)
+		{
+			return Ret;
+		}
+
+		double RetDistanceSquared = -1.;
+		for (int32 i = 0; i < MaxTries; i++)
+		{
+			const FVector2D Candidate = i == 0 ? Ret : Sample();
+
+			// 반경 안에 경계가 없으면 바로 채택, 있으면 경계까지의 거리로 후보 간에 비교함
+			const TOptional<FLoopedSegmentArray2D::FIntersection> Closest = Boundary.FindClosestPointWithin(Candidate, MinDistanceFromEdge);
+			if (!Closest)
+			{
+				return Candidate;
+			}
+
+			const double DistanceSquared = FVector2D::DistSquared(Closest->Location(Boundary), Candidate);
+			if (DistanceSquared > RetDistanceSquared)
+			{
+				Ret = Candidate;
+				RetDistanceSquared = DistanceSquared;
+			}
+		}
+
+		return Ret;
+	}
+
+	double GetArea() const
+	{
+		return TotalArea;
+	}
+
+private:
+	TArray<FVector2D> Vertices;
+	TArray<UE::Geometry::FIndex3i> Triangles;
+	TArray<double> CumulativeAreas;
+	double TotalArea = 0.;
+};
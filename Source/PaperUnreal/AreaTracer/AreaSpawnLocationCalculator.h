@@ -0,0 +1,271 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SegmentArray.h"
+
+
+/**
+ * 월드를 정사각형 칸으로 나누고 영역들이 차지하지 않은 칸을 골라주는 클래스
+ *
+ * 영역마다 차지하는 칸들을 기억해두고 영역의 경계가 바뀌면 그 영역의 칸들만 다시 계산해서 바뀐 칸만 고칩니다.
+ * 영역이 겹칠 수 있으므로 칸마다 차지하는 영역의 개수를 세고 개수가 0인 칸들은 따로 빽빽한 배열에 모아두므로
+ * 빈 칸을 무작위로 고르는 것과 칸 하나를 채우거나 비우는 것 모두 O(1)입니다.
+ */
+class FAreaSpawnLocationCalculator
+{
+public:
+	/**
+	 * World를 한 변이 InCellSideLength인 칸들로 나눕니다. 칸으로 나누고 남는 여백은 양쪽에 똑같이 나눠 줌
+	 * 지금까지 설정한 영역들은 모두 지워지므로 다시 설정해야 합니다.
+	 */
+	void Configure(const FBox2D& World, float InCellSideLength)
+	{
+		check(InCellSideLength > 0.f);
+		CellSideLength = InCellSideLength;
+
+		const FVector2D WidthHeight = World.GetSize();
+		CellXCount = FMath::Max(FMath::FloorToInt(WidthHeight.X / CellSideLength), 0);
+		CellYCount = FMath::Max(FMath::FloorToInt(WidthHeight.Y / CellSideLength), 0);
+
+		const double XMargin = (WidthHeight.X - CellXCount * CellSideLength) / 2.;
+		const double YMargin = (WidthHeight.Y - CellYCount * CellSideLength) / 2.;
+		CellStartX = World.Min.X + XMargin;
+		CellStartY = World.Min.Y + YMargin;
+
+		const int32 CellCount = CellXCount * CellYCount;
+		OccupyingAreaCounts.Init(0, CellCount);
+		EmptyCells.SetNumUninitialized(CellCount);
+		EmptyCellPositions.SetNumUninitialized(CellCount);
+		for (int32 i = 0; i < CellCount; i++)
+		{
+			EmptyCells[i] = i;
+			EmptyCellPositions[i] = i;
+		}
+
+		CellsByArea.Empty();
+	}
+
+	/**
+	 * AreaId에 해당하는 영역의 경계를 설정합니다. 전에 설정한 경계가 있으면 새 경계로 바꿉니다.
+	 */
+	void SetArea(uint32 AreaId, const FLoopedSegmentArray2D& Boundary)
+	{
+		const TArray<int32> NewCells = Rasterize(Boundary);
+		TArray<int32>& OldCells = CellsByArea.FindOrAdd(AreaId);
+
+		// 두 배열 모두 정렬되어 있으므로 한 번에 훑어서 바뀐 칸만 고침
+		int32 OldIndex = 0;
+		int32 NewIndex = 0;
+		while (OldIndex < OldCells.Num() || NewIndex < NewCells.Num())
+		{
+			if (NewIndex == NewCells.Num() || (OldIndex < OldCells.Num() && OldCells[OldIndex] < NewCells[NewIndex]))
+			{
+				Release(OldCells[OldIndex++]);
+			}
+			else if (OldIndex == OldCells.Num() || NewCells[NewIndex] < OldCells[OldIndex])
+			{
+				Occupy(NewCells[NewIndex++]);
+			}
+			else
+			{
+				OldIndex++;
+				NewIndex++;
+			}
+		}
+
+		OldCells = NewCells;
+	}
+
+	void RemoveArea(uint32 AreaId)
+	{
+		if (const TArray<int32>* Cells = CellsByArea.Find(AreaId))
+		{
+			for (int32 Each : *Cells)
+			{
+				Release(Each);
+			}
+			CellsByArea.Remove(AreaId);
+		}
+	}
+
+	TOptional<FBox2D> GetRandomEmptyCell() const
+	{
+		if (EmptyCells.Num() == 0)
+		{
+			return {};
+		}
+
+		return GetCell(EmptyCells[FMath::RandRange(0, EmptyCells.Num() - 1)]);
+	}
+
+	int32 GetEmptyCellCount() const
+	{
+		return EmptyCells.Num();
+	}
+
+	/**
+	 * Point가 들어있는 칸이 비어있는지 반환합니다. 칸 밖의 점이면 false
+	 */
+	bool IsEmptyAt(const FVector2D& Point) const
+	{
+		const int32 X = FMath::FloorToInt((Point.X - CellStartX) / CellSideLength);
+		const int32 Y = FMath::FloorToInt((Point.Y - CellStartY) / CellSideLength);
+		return X >= 0 && X < CellXCount && Y >= 0 && Y < CellYCount && OccupyingAreaCounts[CellIndex1D(X, Y)] == 0;
+	}
+
+private:
+	double CellStartX = 0.;
+	int32 CellXCount = 0;
+	double CellStartY = 0.;
+	int32 CellYCount = 0;
+	float CellSideLength = 1.f;
+
+	/**
+	 * 칸마다 그 칸을 차지하고 있는 영역의 개수
+	 */
+	TArray<uint16> OccupyingAreaCounts;
+
+	/**
+	 * 빈 칸들의 인덱스와 각 칸이 EmptyCells의 몇 번째에 있는지 (차 있으면 INDEX_NONE)
+	 */
+	TArray<int32> EmptyCells;
+	TArray<int32> EmptyCellPositions;
+
+	/**
+	 * 영역마다 차지하고 있는 칸들의 정렬된 인덱스
+	 */
+	TMap<uint32, TArray<int32>> CellsByArea;
+
+	int32 CellIndex1D(int32 X, int32 Y) const
+	{
+		return Y * CellXCount + X;
+	}
+
+	TTuple<int32, int32> CellIndex2D(int32 Index) const
+	{
+		const int32 Y = Index / CellXCount;
+		const int32 X = Index % CellXCount;
+		return MakeTuple(X, Y);
+	}
+
+	FBox2D GetCell(int32 Index) const
+	{
+		const auto [X, Y] = CellIndex2D(Index);
+		return GetCell(X, Y);
+	}
+
+	FBox2D GetCell(int32 X, int32 Y) const
+	{
+		const FVector2D Min{CellStartX + X * CellSideLength, CellStartY + Y * CellSideLength};
+		const FVector2D Max{Min.X + CellSideLength, Min.Y + CellSideLength};
+		return {Min, Max};
+	}
+
+	void Occupy(int32 Cell)
+	{
+		if (OccupyingAreaCounts[Cell]++ == 0)
+		{
+			// 마지막 빈 칸을 이 칸 자리로 옮기고 배열을 줄임
+			const int32 Position = EmptyCellPositions[Cell];
+			const int32 MovedCell = EmptyCells.Last();
+			EmptyCells[Position] = MovedCell;
+			EmptyCellPositions[MovedCell] = Position;
+			EmptyCells.Pop();
+			EmptyCellPositions[Cell] = INDEX_NONE;
+		}
+	}
+
+	void Release(int32 Cell)
+	{
+		if (--OccupyingAreaCounts[Cell] == 0)
+		{
+			EmptyCellPositions[Cell] = EmptyCells.Add(Cell);
+		}
+	}
+
+	/**
+	 * 경계가 이루는 영역과 조금이라도 겹치는 칸들의 인덱스를 정렬해서 반환합니다.
+	 *
+	 * 칸의 행마다 경계가 지나가는 칸들을 구하고, 경계가 지나가지 않는 칸은 완전히 안이거나 밖이므로
+	 * 행의 가운데를 지나는 수평선(Scanline)과 경계의 교차점들 사이에 중심이 있는 칸들을 안쪽 칸으로 채웁니다.
+	 */
+	TArray<int32> Rasterize(const FLoopedSegmentArray2D& Boundary) const
+	{
+		TArray<int32> Ret;
+		if (!Boundary.IsValid() || CellXCount == 0 || CellYCount == 0)
+		{
+			return Ret;
+		}
+
+		const FBox2D Bounds = Boundary.CalculateBoundingBox();
+		const int32 FirstRow = FMath::Max(FMath::FloorToInt((Bounds.Min.Y - CellStartY) / CellSideLength), 0);
+		const int32 LastRow = FMath::Min(FMath::FloorToInt((Bounds.Max.Y - CellStartY) / CellSideLength), CellYCount - 1);
+
+		const auto ToColumn = [&](double X) { return FMath::FloorToInt((X - CellStartX) / CellSideLength); };
+
+		TArray<TPair<int32, int32>> Spans;
+		TArray<double> Crossings;
+		for (int32 Row = FirstRow; Row <= LastRow; Row++)
+		{
+			const double RowMinY = CellStartY + Row * CellSideLength;
+			const double RowMaxY = RowMinY + CellSideLength;
+			const double RowCenterY = RowMinY + CellSideLength / 2.;
+
+			Spans.Reset();
+			Crossings.Reset();
+			for (const FRawSegment2D& Each : Boundary.RawSegments())
+			{
+				const double MinY = FMath::Min(Each.Start.Y, Each.End.Y);
+				const double MaxY = FMath::Max(Each.Start.Y, Each.End.Y);
+				if (MaxY < RowMinY || MinY > RowMaxY)
+				{
+					continue;
+				}
+
+				// 이 행 안에 들어오는 부분의 x 범위에 있는 칸들은 경계가 지나감
+				const double DeltaY = Each.End.Y - Each.Start.Y;
+				const auto XAt = [&](double Y)
+				{
+					return DeltaY == 0. ? Each.Start.X : Each.Start.X + (Each.End.X - Each.Start.X) * (Y - Each.Start.Y) / DeltaY;
+				};
+				const double X0 = DeltaY == 0. ? Each.Start.X : XAt(FMath::Max(MinY, RowMinY));
+				const double X1 = DeltaY == 0. ? Each.End.X : XAt(FMath::Min(MaxY, RowMaxY));
+				Spans.Add({ToColumn(FMath::Min(X0, X1)), ToColumn(FMath::Max(X0, X1))});
+
+				if ((Each.Start.Y > RowCenterY) != (Each.End.Y > RowCenterY))
+				{
+					Crossings.Add(XAt(RowCenterY));
+				}
+			}
+
+			// 교차점 두 개 사이가 영역 안쪽, 그 사이에 중심이 있는 칸들을 채움
+			Crossings.Sort();
+			for (int32 i = 0; i + 1 < Crossings.Num(); i += 2)
+			{
+				const int32 First = FMath::CeilToInt((Crossings[i] - CellStartX) / CellSideLength - 0.5);
+				const int32 Last = FMath::FloorToInt((Crossings[i + 1] - CellStartX) / CellSideLength - 0.5);
+				if (First <= Last)
+				{
+					Spans.Add({First, Last});
+				}
+			}
+
+			Spans.Sort([](const TPair<int32, int32>& Left, const TPair<int32, int32>& Right) { return Left.Key < Right.Key; });
+
+			int32 NextColumn = 0;
+			for (const TPair<int32, int32>& Each : Spans)
+			{
+				const int32 Last = FMath::Min(Each.Value, CellXCount - 1);
+				for (int32 Column = FMath::Max(Each.Key, NextColumn); Column <= Last; Column++)
+				{
+					Ret.Add(CellIndex1D(Column, Row));
+				}
+				NextColumn = FMath::Max(NextColumn, Last + 1);
+			}
+		}
+
+		return Ret;
+	}
+};
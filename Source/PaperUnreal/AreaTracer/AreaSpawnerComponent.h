@@ -4,135 +4,29 @@
 
 #include "CoreMinimal.h"
 #include "AreaActor.h"
+#include "AreaSpawnLocationCalculator.h"
 #include "AreaSpawnerComponent.generated.h"
 
 
-class FAreaSpawnLocationCalculator
+UCLASS(Config=Game)
+class UAreaSpawnerComponent : public UActorComponent2
 {
-public:
-	void Configure(const FBox2D& World, float InCellSideLength)
-	{
-		CellSideLength = InCellSideLength;
-
-		const FVector2D WidthHeight = World.GetSize();
-		CellXCount = WidthHeight.X / CellSideLength;
-		CellYCount = WidthHeight.Y / CellSideLength;
-
-		const float XMargin = (WidthHeight.X - CellXCount * CellSideLength) / 2.f;
-		const float YMargin = (WidthHeight.Y - CellYCount * CellSideLength) / 2.f;
-		CellStartX = World.Min.X + XMargin;
-		CellStartY = World.Min.Y + YMargin;
-
-		ClearGrid();
-	}
-
-	void ClearGrid()
-	{
-		EmptyCells.Empty();
-		for (int32 i = 0; i <= CellIndex1D(CellXCount, CellYCount); i++)
-		{
-			EmptyCells.Add(i);
-		}
-	}
-
-	void OccupyGrid(const FLoopedSegmentArray2D& Area)
-	{
-		TSet<int32> OccupiedCells;
-		const FBox2D AreaBoundingBox = Area.CalculateBoundingBox();
-		ForEachCellInBox(AreaBoundingBox, [&](int32 LinearIndex, const FBox2D& Cell)
-		{
-			const FVector2D LeftTop{Cell.Min.X, Cell.Max.Y};
-			const FVector2D LeftBottom{Cell.Min.X, Cell.Min.Y};
-			const FVector2D RightBottom{Cell.Max.X, Cell.Min.Y};
-			const FVector2D RightTop{Cell.Max.X, Cell.Max.Y};
-			const FSegment2D Edge0{LeftTop, LeftBottom};
-			const FSegment2D Edge1{LeftBottom, RightBottom};
-			const FSegment2D Edge2{RightBottom, RightTop};
-			const FSegment2D Edge3{RightTop, LeftTop};
-
-			if (Cell.IsInside(AreaBoundingBox)
-				|| Area.IsInside(LeftTop)
-				|| Area.IsInside(LeftBottom)
-				|| Area.IsInside(RightBottom)
-				|| Area.IsInside(RightTop)
-				|| Area.FindIntersection(Edge0)
-				|| Area.FindIntersection(Edge1)
-				|| Area.FindIntersection(Edge2)
-				|| Area.FindIntersection(Edge3))
-			{
-				OccupiedCells.Add(LinearIndex);
-			}
-		});
-
-		EmptyCells = EmptyCells.Difference(OccupiedCells);
-	}
-
-	TOptional<FBox2D> GetRandomEmptyCell() const
-	{
-		if (EmptyCells.Num() == 0)
-		{
-			return {};
-		}
-
-		return GetCell(EmptyCells.Array()[FMath::RandRange(0, EmptyCells.Num() - 1)]);
-	}
-
-private:
-	float CellStartX = 0.f;
-	int32 CellXCount = 0;
-	float CellStartY = 0.f;
-	int32 CellYCount = 0;
-	float CellSideLength = 0.f;
-	TSet<int32> EmptyCells;
-
-	int32 CellIndex1D(int32 X, int32 Y) const
-	{
-		return FMath::Min(Y, CellYCount - 1) * CellXCount + FMath::Min(X, CellXCount - 1);
-	}
-
-	TTuple<int32, int32> CellIndex2D(int32 Index) const
-	{
-		const int32 Y = Index / CellYCount;
-		const int32 X = Index % CellYCount;
-		return MakeTuple(X, Y);
-	}
-
-	FBox2D GetCell(int32 Index) const
-	{
-		const auto [X, Y] = CellIndex2D(Index);
-		return GetCell(X, Y);
-	}
+	GENERATED_BODY()
 
-	FBox2D GetCell(int32 X, int32 Y) const
-	{
-		const FVector2D Min{CellStartX + X * CellSideLength, CellStartY + Y * CellSideLength};
-		const FVector2D Max{Min.X + CellSideLength, Min.Y + CellSideLength};
-		return {Min, Max};
-	}
+public:
+	TLiveDataView<TArray<AAreaActor*>&> GetSpawnedAreas() { return SpawnedAreas; }
 
-	template <typename FuncType>
-	void ForEachCellInBox(const FBox2D& Box, const FuncType& Func) const
+	/**
+	 * 영역을 스폰할 위치를 고를 때 쓰는 월드 범위와 칸 크기를 설정합니다. 이미 스폰된 영역들은 새 칸에 다시 반영됨
+	 */
+	void ConfigureSpawnGrid(const FBox2D& World, float CellSideLength)
 	{
-		const int32 FirstXIndex = (Box.Min.X - CellStartX) / CellSideLength;
-		const int32 FirstYIndex = (Box.Min.Y - CellStartY) / CellSideLength;
-		for (int32 Y = FirstYIndex; Y < CellYCount; Y++)
+		SpawnLocationCalculator.Configure(World, CellSideLength);
+		for (AAreaActor* Each : SpawnedAreas.Get())
 		{
-			for (int32 X = FirstXIndex; X < CellXCount; X++)
-			{
-				Func(CellIndex1D(X, Y), GetCell(X, Y));
-			}
+			SpawnLocationCalculator.SetArea(Each->GetUniqueID(), Each->ServerAreaBoundary->GetBoundary().Get());
 		}
 	}
-};
-
-
-UCLASS()
-class UAreaSpawnerComponent : public UActorComponent2
-{
-	GENERATED_BODY()
-
-public:
-	TLiveDataView<TArray<AAreaActor*>&> GetSpawnedAreas() { return SpawnedAreas; }
 
 	AAreaActor* SpawnAreaAtRandomEmptyLocation(const auto& Initializer)
 	{
@@ -152,10 +46,23 @@ public:
 
 		auto NewComponent = NewObject<UActorComponent2>(Ret);
 		NewComponent->RegisterComponent();
-		NewComponent->OnEndPlay.AddWeakLambda(this, [this, Ret]() { SpawnedAreas.Remove(Ret); });
+		NewComponent->OnEndPlay.AddWeakLambda(this, [this, Ret, AreaId = Ret->GetUniqueID()]()
+		{
+			SpawnedAreas.Remove(Ret);
+			SpawnLocationCalculator.RemoveArea(AreaId);
+		});
 
 		SpawnedAreas.Add(Ret);
 
+		// 스폰할 때마다 모든 영역을 다시 칸에 칠하지 않도록 경계가 바뀔 때마다 그 영역의 칸만 갱신해둠
+		Ret->ServerAreaBoundary->GetBoundary().Observe(this, [this, Ret, AreaId = Ret->GetUniqueID()](const FLoopedSegmentArray2D& Boundary)
+		{
+			if (SpawnedAreas.Get().Contains(Ret))
+			{
+				SpawnLocationCalculator.SetArea(AreaId, Boundary);
+			}
+		});
+
 		return Ret;
 	}
 
@@ -173,6 +80,18 @@ private:
 		DOREPLIFETIME(ThisClass, RepSpawnedAreas);
 	}
 
+	/**
+	 * 영역을 스폰할 수 있는 월드 범위, 레벨마다 다르면 DefaultGame.ini에서 바꿈
+	 */
+	UPROPERTY(Config)
+	FBox2D SpawnWorldBounds{FVector2D::Zero(), {3000.f, 3000.f}};
+
+	/**
+	 * 스폰 위치를 고르는 칸의 한 변의 길이, 영역 하나가 처음 차지하는 크기보다 커야 함
+	 */
+	UPROPERTY(Config)
+	float SpawnCellSideLength = 300.f;
+
 	FAreaSpawnLocationCalculator SpawnLocationCalculator;
 
 	UAreaSpawnerComponent()
@@ -185,9 +104,7 @@ private:
 	{
 		Super::InitializeComponent();
 
-		// TODO get this from an actor in the world
-		SpawnLocationCalculator.Configure(
-			{FVector2D::Zero(), {3000.f, 3000.f}}, 300.f);
+		ConfigureSpawnGrid(SpawnWorldBounds, SpawnCellSideLength);
 	}
 
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override
@@ -208,14 +125,8 @@ private:
 		}
 	}
 
-	TOptional<FBox2D> FindEmptyCell()
+	TOptional<FBox2D> FindEmptyCell() const
 	{
-		SpawnLocationCalculator.ClearGrid();
-		for (AAreaActor* Each : SpawnedAreas.Get())
-		{
-			const auto AreaBoundary = Each->FindComponentByClass<UAreaBoundaryComponent>();
-			SpawnLocationCalculator.OccupyGrid(AreaBoundary->GetBoundary().Get());
-		}
 		return SpawnLocationCalculator.GetRandomEmptyCell();
-	};
+	}
 };
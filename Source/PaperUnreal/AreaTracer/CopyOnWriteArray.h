@@ -0,0 +1,88 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+ * 복사할 때 원소들을 복사하지 않고 버퍼를 공유하다가 수정하기 직전에 다른 복사본과 공유 중이면 그 때 복사하는 배열
+ *
+ * 읽기는 TArray와 같은 const 함수들로 하고 수정은 반드시 Mutable()로 얻은 TArray에 대해서 해야 합니다.
+ * Mutable()이 반환한 참조는 이 객체가 다시 복사되기 전까지만 유효하며 그 사이에 복사본이 생기면 복사본에도 수정이 보이므로 주의해야 함
+ * 빈 배열은 버퍼를 만들지 않으므로 기본 생성도 할당이 없습니다.
+ */
+template <typename ElementType>
+class TCopyOnWriteArray
+{
+public:
+	using FArrayType = TArray<ElementType>;
+
+	TCopyOnWriteArray() = default;
+
+	TCopyOnWriteArray(const FArrayType& Init)
+		: Buffer(Init.IsEmpty() ? nullptr : MakeShared<FArrayType>(Init))
+	{
+	}
+
+	TCopyOnWriteArray(FArrayType&& Init)
+		: Buffer(Init.IsEmpty() ? nullptr : MakeShared<FArrayType>(MoveTemp(Init)))
+	{
+	}
+
+	TCopyOnWriteArray& operator=(FArrayType&& NewArray)
+	{
+		Buffer = NewArray.IsEmpty() ? nullptr : MakeShared<FArrayType>(MoveTemp(NewArray));
+		return *this;
+	}
+
+	const FArrayType& Get() const
+	{
+		static const FArrayType EmptyArray;
+		return Buffer ? *Buffer : EmptyArray;
+	}
+
+	/**
+	 * 수정 가능한 배열을 반환합니다. 다른 복사본과 버퍼를 공유 중이면 이 시점에 버퍼를 복사합니다.
+	 */
+	FArrayType& Mutable()
+	{
+		if (!Buffer)
+		{
+			Buffer = MakeShared<FArrayType>();
+		}
+		else if (!Buffer.IsUnique())
+		{
+			Buffer = MakeShared<FArrayType>(*Buffer);
+		}
+
+		return *Buffer;
+	}
+
+	/**
+	 * 버퍼를 다른 복사본과 공유하지 않고 모두 비웁니다.
+	 */
+	void Empty()
+	{
+		Buffer.Reset();
+	}
+
+	/**
+	 * 다른 복사본과 버퍼를 공유 중인지 여부를 반환합니다.
+	 */
+	bool IsShared() const
+	{
+		return Buffer.IsValid() && !Buffer.IsUnique();
+	}
+
+	int32 Num() const { return Get().Num(); }
+	bool IsEmpty() const { return Get().IsEmpty(); }
+	const ElementType* GetData() const { return Get().GetData(); }
+	const ElementType& operator[](int32 Index) const { return Get()[Index]; }
+	const ElementType& Last() const { return Get().Last(); }
+	auto begin() const { return Get().begin(); }
+	auto end() const { return Get().end(); }
+
+private:
+	TSharedPtr<FArrayType> Buffer;
+};
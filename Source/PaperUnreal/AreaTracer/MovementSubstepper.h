@@ -0,0 +1,75 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+ * 프레임마다 한 번씩 받은 위치와 속도로 프레임 사이의 중간 위치들을 고정된 시간 간격으로 복원해주는 클래스
+ *
+ * 서버 틱 레이트가 낮으면 프레임 사이의 직선 이동이 실제 이동 경로와 많이 달라지므로
+ * 이전 프레임과 이번 프레임의 위치, 속도로 Cubic Hermite 곡선을 만들고 Interval 간격의 시각마다 곡선 위의 위치를 뽑습니다.
+ * 뽑는 시각은 프레임 경계와 상관없이 Interval의 배수이므로 틱 레이트를 바꿔도 같은 움직임에서 거의 같은 위치들이 나옵니다.
+ */
+class FMovementSubstepper
+{
+public:
+	/**
+	 * @param Seconds 0 이하면 복원하지 않고 프레임 끝 위치만 사용함
+	 */
+	void SetInterval(float Seconds)
+	{
+		Interval = Seconds;
+		TimeSinceLastStep = 0.;
+	}
+
+	bool IsEnabled() const
+	{
+		return Interval > 0.f;
+	}
+
+	/**
+	 * 이번 프레임 끝의 위치와 속도를 받아 지난 프레임 이후의 위치들을 시간 순서대로 Func에 넘깁니다.
+	 * 마지막으로 넘기는 위치는 항상 Location입니다.
+	 */
+	template <typename FuncType>
+	void Tick(const FVector2D& Location, const FVector2D& Velocity, float DeltaTime, const FuncType& Func)
+	{
+		if (IsEnabled() && LastLocation && DeltaTime > 0.f)
+		{
+			double StepTime = Interval - TimeSinceLastStep;
+			int32 StepCount = 0;
+			for (; StepTime < DeltaTime && StepCount < MaxStepsPerTick; StepTime += Interval, StepCount++)
+			{
+				Func(Interpolate(Location, Velocity, DeltaTime, StepTime / DeltaTime));
+			}
+
+			// 히치로 스텝이 너무 많이 밀리면 따라잡지 않고 이번 프레임 끝에서 다시 시작함
+			TimeSinceLastStep = StepCount < MaxStepsPerTick ? DeltaTime - (StepTime - Interval) : 0.;
+		}
+
+		Func(Location);
+
+		LastLocation = Location;
+		LastVelocity = Velocity;
+	}
+
+private:
+	static constexpr int32 MaxStepsPerTick = 32;
+
+	float Interval = 0.f;
+	double TimeSinceLastStep = 0.;
+	TOptional<FVector2D> LastLocation;
+	FVector2D LastVelocity = FVector2D::ZeroVector;
+
+	FVector2D Interpolate(const FVector2D& Location, const FVector2D& Velocity, float DeltaTime, double Alpha) const
+	{
+		const double A2 = Alpha * Alpha;
+		const double A3 = A2 * Alpha;
+		return (2. * A3 - 3. * A2 + 1.) * *LastLocation
+			+ (A3 - 2. * A2 + Alpha) * DeltaTime * LastVelocity
+			+ (-2. * A3 + 3. * A2) * Location
+			+ (A3 - A2) * DeltaTime * Velocity;
+	}
+};
@@ -0,0 +1,140 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "QuantizedSegmentArray.h"
+
+
+/**
+ * 점들을 네트워크로 보낼 때 좌표를 격자에 맞춰 정수로 바꾸고 앞 점과의 차이만 가변 길이 정수로 직렬화하는 클래스
+ *
+ * 트레이서 경로나 영역 경계의 이웃한 점들은 보통 수십 cm 이내로 붙어있으므로 차이를 ZigZag 인코딩한 다음
+ * 7비트씩 끊어서 쓰면 축마다 1~2바이트면 충분합니다. (FVector2D 그대로 보내면 점마다 16바이트)
+ * 직렬화는 FArchive의 바이트 단위 연산만 사용하므로 FNetBitWriter로 NetSerialize에서 그대로 쓸 수 있습니다.
+ *
+ * 격자는 FQuantizedSegmentArray2D와 같은 것을 사용하므로 어느 쪽으로 양자화해도 같은 점은 같은 정수 좌표가 됩니다.
+ */
+class FQuantizedPointCodec
+{
+public:
+	/**
+	 * 받는 쪽에서 잘못된 데이터 때문에 한 번에 너무 큰 배열을 할당하지 않도록 제한함
+	 */
+	static constexpr int32 MaxPointCount = 1 << 20;
+
+	static FIntPoint Quantize(const FVector2D& Point)
+	{
+		return FQuantizedSegmentArray2D::Quantize(Point);
+	}
+
+	static FVector2D Dequantize(const FIntPoint& Point)
+	{
+		return FQuantizedSegmentArray2D::Dequantize(Point);
+	}
+
+	/**
+	 * 점들을 개수와 함께 직렬화합니다. 읽을 때는 Points를 격자에 맞춰진 좌표들로 덮어씀
+	 */
+	template <typename ArchiveType>
+	static void SerializePoints(ArchiveType& Ar, TArray<FVector2D>& Points)
+	{
+		uint64 Count = Points.Num();
+		SerializeVarint(Ar, Count);
+
+		if (Ar.IsLoading())
+		{
+			if (Count > MaxPointCount)
+			{
+				Ar.SetError();
+				return;
+			}
+
+			Points.SetNumUninitialized(static_cast<int32>(Count));
+		}
+
+		FIntPoint Previous{0, 0};
+		for (FVector2D& Each : Points)
+		{
+			if (Ar.IsError())
+			{
+				return;
+			}
+
+			FIntPoint Current = Ar.IsLoading() ? FIntPoint{} : Quantize(Each);
+			SerializeDelta(Ar, Previous, Current);
+			if (Ar.IsLoading())
+			{
+				Each = Dequantize(Current);
+			}
+			Previous = Current;
+		}
+	}
+
+	/**
+	 * Current를 Previous에 대한 차이로 직렬화합니다. 읽을 때는 Current에 읽은 좌표가 들어감
+	 */
+	template <typename ArchiveType>
+	static void SerializeDelta(ArchiveType& Ar, const FIntPoint& Previous, FIntPoint& Current)
+	{
+		uint64 X = ZigZagEncode(static_cast<int64>(Current.X) - Previous.X);
+		uint64 Y = ZigZagEncode(static_cast<int64>(Current.Y) - Previous.Y);
+		SerializeVarint(Ar, X);
+		SerializeVarint(Ar, Y);
+
+		if (Ar.IsLoading())
+		{
+			Current.X = static_cast<int32>(Previous.X + ZigZagDecode(X));
+			Current.Y = static_cast<int32>(Previous.Y + ZigZagDecode(Y));
+		}
+	}
+
+	/**
+	 * 7비트씩 끊어서 하위 비트부터 쓰고 뒤에 바이트가 더 있으면 최상위 비트를 켬
+	 */
+	template <typename ArchiveType>
+	static void SerializeVarint(ArchiveType& Ar, uint64& Value)
+	{
+		if (Ar.IsLoading())
+		{
+			Value = 0;
+			for (int32 Shift = 0; Shift < 64; Shift += 7)
+			{
+				uint8 Byte = 0;
+				Ar << Byte;
+				Value |= static_cast<uint64>(Byte & 0x7f) << Shift;
+				if (!(Byte & 0x80) || Ar.IsError())
+				{
+					return;
+				}
+			}
+
+			// 10바이트를 넘는 값은 있을 수 없으므로 잘못된 데이터
+			Ar.SetError();
+			return;
+		}
+
+		uint64 Remaining = Value;
+		do
+		{
+			uint8 Byte = Remaining & 0x7f;
+			Remaining >>= 7;
+			Byte |= Remaining ? 0x80 : 0;
+			Ar << Byte;
+		}
+		while (Remaining);
+	}
+
+	/**
+	 * 절댓값이 작은 음수도 작은 양수가 되도록 부호를 최하위 비트로 옮김 (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...)
+	 */
+	static uint64 ZigZagEncode(int64 Value)
+	{
+		return (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63);
+	}
+
+	static int64 ZigZagDecode(uint64 Value)
+	{
+		return static_cast<int64>(Value >> 1) ^ -static_cast<int64>(Value & 1);
+	}
+};
@@ -0,0 +1,273 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SegmentArray.h"
+
+
+template <bool>
+class TQuantizedSegmentArray2D;
+
+/**
+ * FSegmentArray2D의 정수 좌표 버전
+ */
+using FQuantizedSegmentArray2D = TQuantizedSegmentArray2D<false>;
+
+/**
+ * FLoopedSegmentArray2D의 정수 좌표 버전
+ */
+using FQuantizedLoopedSegmentArray2D = TQuantizedSegmentArray2D<true>;
+
+
+/**
+ * TSegmentArray2D의 점들을 고정소수점 정수 좌표로 저장하는 버전
+ *
+ * 좌표를 1/16cm 단위의 int32로 저장하므로 방향 판정, 교차 검사, 내부 판정, 넓이 계산을 오차 없이 정수 연산으로 할 수 있습니다.
+ * 즉 TSegmentArray2D처럼 경계에 걸친 점이나 평행한 Segment를 UE_KINDA_SMALL_NUMBER로 얼버무릴 필요가 없습니다.
+ * 점 하나의 크기도 FVector2D의 절반이므로 저장하거나 전송할 때도 유리합니다.
+ *
+ * FVector2D 좌표와는 Quantize와 Dequantize로 변환하며 TSegmentArray2D와도 서로 변환할 수 있습니다.
+ *
+ * @tparam bLoop 시작점과 끝점을 이어붙일 것인지 여부
+ */
+template <bool bLoop>
+class TQuantizedSegmentArray2D
+{
+public:
+	/**
+	 * 1cm를 몇 칸으로 나누어 저장하는지
+	 */
+	static constexpr int32 UnitsPerCentimeter = 16;
+
+	/**
+	 * 저장할 수 있는 좌표의 절댓값의 최댓값 (약 335km)
+	 * 두 좌표의 차이끼리 곱한 외적 두 개를 더해도 int64를 넘지 않도록 제한함
+	 */
+	static constexpr int32 MaxCoordinate = 1 << 29;
+
+	static FIntPoint Quantize(const FVector2D& Point)
+	{
+		const auto QuantizeAxis = [](double Value)
+		{
+			const double Clamped = FMath::Clamp(Value * UnitsPerCentimeter, static_cast<double>(-MaxCoordinate), static_cast<double>(MaxCoordinate));
+			return static_cast<int32>(FMath::RoundToInt64(Clamped));
+		};
+
+		return {QuantizeAxis(Point.X), QuantizeAxis(Point.Y)};
+	}
+
+	static FVector2D Dequantize(const FIntPoint& Point)
+	{
+		return {static_cast<double>(Point.X) / UnitsPerCentimeter, static_cast<double>(Point.Y) / UnitsPerCentimeter};
+	}
+
+	TQuantizedSegmentArray2D() = default;
+
+	explicit TQuantizedSegmentArray2D(TArray<FIntPoint> InitPoints)
+		: Points(MoveTemp(InitPoints))
+	{
+	}
+
+	explicit TQuantizedSegmentArray2D(const TSegmentArray2D<bLoop>& Source)
+	{
+		Points.Reserve(Source.PointCount());
+		for (const FVector2D& Each : Source.GetPoints())
+		{
+			Points.Add(Quantize(Each));
+		}
+	}
+
+	TSegmentArray2D<bLoop> ToSegmentArray() const
+	{
+		TArray<FVector2D> Ret;
+		Ret.Reserve(Points.Num());
+		for (const FIntPoint& Each : Points)
+		{
+			Ret.Add(Dequantize(Each));
+		}
+		return TSegmentArray2D<bLoop>{MoveTemp(Ret)};
+	}
+
+	const TArray<FIntPoint>& GetPoints() const
+	{
+		return Points;
+	}
+
+	int32 PointCount() const
+	{
+		return Points.Num();
+	}
+
+	int32 SegmentCount() const
+	{
+		if constexpr (bLoop)
+		{
+			return PointCount();
+		}
+		else
+		{
+			return FMath::Max(PointCount() - 1, 0);
+		}
+	}
+
+	/**
+	 * TSegmentArray2D::IsValid 참고
+	 */
+	bool IsValid() const
+	{
+		return Points.Num() >= (bLoop ? 3 : 2);
+	}
+
+	/**
+	 * 파이썬과 같은 마이너스 인덱스를 허용합니다.
+	 */
+	const FIntPoint& GetPoint(int32 Index) const
+	{
+		return Points[Index >= 0 ? Index : PointCount() + Index];
+	}
+
+	void AddPoint(const FIntPoint& Point)
+	{
+		Points.Add(Point);
+	}
+
+	void SetPoint(int32 Index, const FIntPoint& Point)
+	{
+		Points[Index >= 0 ? Index : PointCount() + Index] = Point;
+	}
+
+	const FIntPoint& GetSegmentStart(int32 SegmentIndex) const
+	{
+		return Points[SegmentIndex];
+	}
+
+	const FIntPoint& GetSegmentEnd(int32 SegmentIndex) const
+	{
+		return Points[SegmentIndex + 1 < Points.Num() ? SegmentIndex + 1 : 0];
+	}
+
+	/**
+	 * A에서 B를 바라볼 때 C가 왼쪽에 있으면 양수, 오른쪽에 있으면 음수, 일직선 위에 있으면 0을 반환합니다.
+	 */
+	static int64 Orientation(const FIntPoint& A, const FIntPoint& B, const FIntPoint& C)
+	{
+		return static_cast<int64>(B.X - A.X) * (C.Y - A.Y) - static_cast<int64>(B.Y - A.Y) * (C.X - A.X);
+	}
+
+	/**
+	 * Start에서 End까지의 Segment가 이 배열의 SegmentIndex번째 Segment와 교차하는지 반환합니다.
+	 * 끝점이 다른 Segment 위에 닿거나 일직선으로 겹치는 경우도 교차로 봅니다.
+	 */
+	bool SegmentIntersects(int32 SegmentIndex, const FIntPoint& Start, const FIntPoint& End) const
+	{
+		return SegmentsIntersect(GetSegmentStart(SegmentIndex), GetSegmentEnd(SegmentIndex), Start, End);
+	}
+
+	/**
+	 * Start에서 End까지의 Segment와 교차하는 모든 Segment의 인덱스를 오름차순으로 반환합니다.
+	 */
+	TArray<int32> FindAllIntersectingSegments(const FIntPoint& Start, const FIntPoint& End) const
+	{
+		TArray<int32> Ret;
+		for (int32 i = 0; i < SegmentCount(); i++)
+		{
+			if (SegmentIntersects(i, Start, End))
+			{
+				Ret.Add(i);
+			}
+		}
+		return Ret;
+	}
+
+	/**
+	 * 넓이의 두 배를 1/16cm 단위의 제곱으로 반환합니다. 정수이므로 오차가 없습니다.
+	 * 부호는 TSegmentArray2D::CalculateSignedArea와 같습니다.
+	 */
+	int64 CalculateSignedDoubleArea() const requires bLoop
+	{
+		int64 Ret = 0;
+		for (int32 i = 0; i < Points.Num(); i++)
+		{
+			Ret += Orientation(Points[0], GetSegmentStart(i), GetSegmentEnd(i));
+		}
+		return Ret;
+	}
+
+	/**
+	 * 넓이를 cm 단위의 제곱으로 반환합니다.
+	 */
+	float CalculateArea() const requires bLoop
+	{
+		const double UnitArea = 1. / (UnitsPerCentimeter * UnitsPerCentimeter);
+		return static_cast<float>(0.5 * FMath::Abs(static_cast<double>(CalculateSignedDoubleArea())) * UnitArea);
+	}
+
+	bool IsClockwise() const requires bLoop
+	{
+		return CalculateSignedDoubleArea() > 0;
+	}
+
+	/**
+	 * 점이 영역 안에 있는지 반환합니다. 경계 위의 점은 안에 있는 것으로 봅니다.
+	 */
+	bool IsInside(const FIntPoint& Point) const requires bLoop
+	{
+		bool bInside = false;
+		for (int32 i = 0; i < Points.Num(); i++)
+		{
+			const FIntPoint& Start = GetSegmentStart(i);
+			const FIntPoint& End = GetSegmentEnd(i);
+			const int64 Side = Orientation(Start, End, Point);
+
+			if (Side == 0 && IsInBoundingBox(Start, End, Point))
+			{
+				return true;
+			}
+
+			// 오른쪽으로 쏜 반직선이 Segment를 지나는지 검사, 끝점이 정확히 걸치는 경우를 두 번 세지 않도록 위쪽 끝점은 제외함
+			if ((Start.Y > Point.Y) != (End.Y > Point.Y))
+			{
+				const bool bUpward = End.Y > Start.Y;
+				if (bUpward ? Side > 0 : Side < 0)
+				{
+					bInside = !bInside;
+				}
+			}
+		}
+
+		return bInside;
+	}
+
+	bool IsInside(const FVector2D& Point) const requires bLoop
+	{
+		return IsInside(Quantize(Point));
+	}
+
+private:
+	TArray<FIntPoint> Points;
+
+	static bool IsInBoundingBox(const FIntPoint& Start, const FIntPoint& End, const FIntPoint& Point)
+	{
+		return FMath::Min(Start.X, End.X) <= Point.X && Point.X <= FMath::Max(Start.X, End.X)
+			&& FMath::Min(Start.Y, End.Y) <= Point.Y && Point.Y <= FMath::Max(Start.Y, End.Y);
+	}
+
+	static bool SegmentsIntersect(const FIntPoint& A, const FIntPoint& B, const FIntPoint& C, const FIntPoint& D)
+	{
+		const int64 O0 = Orientation(A, B, C);
+		const int64 O1 = Orientation(A, B, D);
+		const int64 O2 = Orientation(C, D, A);
+		const int64 O3 = Orientation(C, D, B);
+
+		if (((O0 > 0 && O1 < 0) || (O0 < 0 && O1 > 0)) && ((O2 > 0 && O3 < 0) || (O2 < 0 && O3 > 0)))
+		{
+			return true;
+		}
+
+		return (O0 == 0 && IsInBoundingBox(A, B, C))
+			|| (O1 == 0 && IsInBoundingBox(A, B, D))
+			|| (O2 == 0 && IsInBoundingBox(C, D, A))
+			|| (O3 == 0 && IsInBoundingBox(C, D, B));
+	}
+};
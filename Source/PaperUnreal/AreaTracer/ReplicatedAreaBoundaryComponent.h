@@ -4,11 +4,109 @@
 
 #include "CoreMinimal.h"
 #include "AreaBoundaryComponent.h"
+#include "AreaBoundaryDelta.h"
 #include "AreaBoundaryProvider.h"
+#include "QuantizedPointCodec.h"
 #include "Net/UnrealNetwork.h"
 #include "ReplicatedAreaBoundaryComponent.generated.h"
 
 
+USTRUCT()
+struct FAreaBoundarySplice
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Index = 0;
+
+	UPROPERTY()
+	int32 RemoveCount = 0;
+
+	UPROPERTY()
+	TArray<FVector2D> Points;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+	{
+		uint32 PackedIndex = Index;
+		uint32 PackedRemoveCount = RemoveCount;
+		Ar.SerializeIntPacked(PackedIndex);
+		Ar.SerializeIntPacked(PackedRemoveCount);
+		Index = PackedIndex;
+		RemoveCount = PackedRemoveCount;
+
+		FQuantizedPointCodec::SerializePoints(Ar, Points);
+		bOutSuccess = !Ar.IsError();
+		return true;
+	}
+};
+
+template <>
+struct TStructOpsTypeTraits<FAreaBoundarySplice> : public TStructOpsTypeTraitsBase2<FAreaBoundarySplice>
+{
+	enum { WithNetSerializer = true };
+};
+
+
+/**
+ * 바로 앞 Sequence의 경계에 적용하면 Sequence의 경계가 되는 편집 내역 (FAreaBoundaryDelta 참고)
+ */
+USTRUCT()
+struct FAreaBoundaryDeltaOp
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Sequence = 0;
+
+	UPROPERTY()
+	int32 Rotation = 0;
+
+	UPROPERTY()
+	TArray<FAreaBoundarySplice> Splices;
+};
+
+
+USTRUCT()
+struct FAreaBoundaryKeyframe
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Sequence = 0;
+
+	UPROPERTY()
+	TArray<FVector2D> Points;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+	{
+		uint32 PackedSequence = Sequence;
+		Ar.SerializeIntPacked(PackedSequence);
+		Sequence = PackedSequence;
+
+		FQuantizedPointCodec::SerializePoints(Ar, Points);
+		bOutSuccess = !Ar.IsError();
+		return true;
+	}
+};
+
+template <>
+struct TStructOpsTypeTraits<FAreaBoundaryKeyframe> : public TStructOpsTypeTraitsBase2<FAreaBoundaryKeyframe>
+{
+	enum { WithNetSerializer = true };
+};
+
+
+/**
+ * 서버의 경계를 클라이언트에 복제하는 컴포넌트
+ *
+ * 경계가 바뀔 때마다 전체 점 배열을 보내면 작은 확장에도 수천 개의 점을 다시 보내게 되고
+ * 배열이 커지면 Partial Bunch가 많아져서 채널 전체가 막힐 수 있으므로 (ReplicatedTracerPathComponent.h 최상단 설명 참고)
+ * 평소에는 바뀐 구간만 담은 편집 내역을 Sequence 번호와 함께 보내고 가끔씩만 전체 배열(Keyframe)을 보냅니다.
+ *
+ * 편집 내역은 Sequence % DeltaOpWindow 자리에 덮어쓰는 고정 크기 배열로 복제하므로 바뀐 원소만 전송되고,
+ * Keyframe은 DeltaOpWindow개의 편집마다 새로 만들기 때문에 배열에 남아있는 가장 오래된 편집 바로 앞까지는 항상 Keyframe으로 따라잡을 수 있습니다.
+ * 나중에 접속한 클라이언트나 패킷 손실로 편집을 놓친 클라이언트는 Keyframe부터 다시 시작함
+ */
 UCLASS()
 class UReplicatedAreaBoundaryComponent : public UActorComponent2, public IAreaBoundaryProvider
 {
@@ -23,19 +121,40 @@ public:
 	}
 
 private:
-	UPROPERTY(ReplicatedUsing=OnRep_Points)
-	TArray<FVector2D> RepPoints;
+	static constexpr int32 DeltaOpWindow = 32;
+
+	UPROPERTY(ReplicatedUsing=OnRep_Keyframe)
+	FAreaBoundaryKeyframe RepKeyframe;
+
+	UPROPERTY(ReplicatedUsing=OnRep_DeltaOps)
+	TArray<FAreaBoundaryDeltaOp> RepDeltaOps;
+
 	TLiveData<FLoopedSegmentArray2D> AreaBoundary;
 
+	/**
+	 * 서버에서는 마지막으로 보낸 경계, 클라이언트에서는 Sequence까지 적용한 경계의 점들
+	 */
+	TArray<FVector2D> Points;
+	int32 Sequence = 0;
+
+	/**
+	 * 적용할 수 없는 편집 내역을 받으면 (Points가 서버와 어긋났거나 잘못된 패킷) 그 이후의 편집 내역은 모두 무시하고 다음 Keyframe을 기다림
+	 */
+	bool bWaitingForKeyframe = false;
+
+	UFUNCTION()
+	void OnRep_Keyframe() { CatchUp(); }
+
 	UFUNCTION()
-	void OnRep_Points() { AreaBoundary.SetValueNoComparison(RepPoints); }
+	void OnRep_DeltaOps() { CatchUp(); }
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override
 	{
 		Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-		DOREPLIFETIME(ThisClass, RepPoints);
+		DOREPLIFETIME(ThisClass, RepKeyframe);
+		DOREPLIFETIME(ThisClass, RepDeltaOps);
 	}
-	
+
 	UPROPERTY()
 	UAreaBoundaryComponent* BoundarySource;
 
@@ -54,9 +173,84 @@ private:
 			return;
 		}
 
-		BoundarySource->GetBoundary().Observe(this, [this](const auto& SourceBoundary)
+		RepDeltaOps.SetNum(DeltaOpWindow);
+		BoundarySource->GetBoundary().Observe(this, [this](const FLoopedSegmentArray2D& SourceBoundary)
 		{
-			RepPoints = SourceBoundary.GetPoints();
+			Publish(SourceBoundary.GetPoints());
 		});
 	}
+
+	void Publish(const TArray<FVector2D>& NewPoints)
+	{
+		const FAreaBoundaryDelta Delta = FAreaBoundaryDelta::Make(Points, NewPoints);
+		if (Delta.IsEmpty())
+		{
+			return;
+		}
+
+		Sequence++;
+		Points = NewPoints;
+
+		// 편집 내역이 전체 배열만큼 크면 (처음 복제하거나 경계가 통째로 바뀐 경우) 편집 내역 대신 Keyframe을 보냄
+		if (Sequence - RepKeyframe.Sequence >= DeltaOpWindow || Delta.GetPointCount() >= NewPoints.Num() / 2)
+		{
+			RepKeyframe.Sequence = Sequence;
+			RepKeyframe.Points = NewPoints;
+			return;
+		}
+
+		FAreaBoundaryDeltaOp& Op = RepDeltaOps[Sequence % DeltaOpWindow];
+		Op.Sequence = Sequence;
+		Op.Rotation = Delta.Rotation;
+		Op.Splices.Reset();
+		for (const FAreaBoundaryDelta::FSplice& Each : Delta.Splices)
+		{
+			FAreaBoundarySplice& Splice = Op.Splices.AddDefaulted_GetRef();
+			Splice.Index = Each.Index;
+			Splice.RemoveCount = Each.RemoveCount;
+			Splice.Points = Each.Points;
+		}
+	}
+
+	void CatchUp()
+	{
+		const int32 OldSequence = Sequence;
+
+		if (RepKeyframe.Sequence > Sequence)
+		{
+			Points = RepKeyframe.Points;
+			Sequence = RepKeyframe.Sequence;
+			bWaitingForKeyframe = false;
+		}
+
+		// 다음 편집이 아직 도착하지 않았으면 (TArray 원소는 따로 도착할 수 있음) 도착할 때까지 기다림
+		while (!bWaitingForKeyframe
+			&& RepDeltaOps.IsValidIndex((Sequence + 1) % DeltaOpWindow)
+			&& RepDeltaOps[(Sequence + 1) % DeltaOpWindow].Sequence == Sequence + 1)
+		{
+			const FAreaBoundaryDeltaOp& Op = RepDeltaOps[(Sequence + 1) % DeltaOpWindow];
+
+			FAreaBoundaryDelta Delta;
+			Delta.Rotation = Op.Rotation;
+			for (const FAreaBoundarySplice& Each : Op.Splices)
+			{
+				Delta.Splices.Add({Each.Index, Each.RemoveCount, Each.Points});
+			}
+
+			TOptional<TArray<FVector2D>> Applied = Delta.Apply(Points);
+			if (!Applied)
+			{
+				bWaitingForKeyframe = true;
+				break;
+			}
+
+			Points = MoveTemp(*Applied);
+			Sequence++;
+		}
+
+		if (Sequence != OldSequence)
+		{
+			AreaBoundary.SetValueNoComparison(Points);
+		}
+	}
 };
@@ -3,8 +3,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "QuantizedPointCodec.h"
 #include "TracerPathComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "PaperUnreal/WeakCoroutine/WeakCoroutine.h"
 #include "ReplicatedTracerPathComponent.generated.h"
 
@@ -84,19 +86,123 @@ struct FOptionalVector2D
 
 		return *this;
 	}
+
+	/**
+	 * bSet은 1비트, 좌표는 FQuantizedPointCodec의 격자에 맞춰 가변 길이 정수로 보냄
+	 */
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+	{
+		uint8 bSetBit = bSet;
+		Ar.SerializeBits(&bSetBit, 1);
+		bSet = !!bSetBit;
+
+		if (bSet)
+		{
+			FIntPoint Quantized = Ar.IsLoading() ? FIntPoint{} : FQuantizedPointCodec::Quantize(Vector2D);
+			FQuantizedPointCodec::SerializeDelta(Ar, FIntPoint{0, 0}, Quantized);
+			if (Ar.IsLoading())
+			{
+				Vector2D = FQuantizedPointCodec::Dequantize(Quantized);
+			}
+		}
+		else if (Ar.IsLoading())
+		{
+			Vector2D = FVector2D::ZeroVector;
+		}
+
+		bOutSuccess = !Ar.IsError();
+		return true;
+	}
 };
 
+template <>
+struct TStructOpsTypeTraits<FOptionalVector2D> : public TStructOpsTypeTraitsBase2<FOptionalVector2D>
+{
+	enum { WithNetSerializer = true };
+};
 
+
+/**
+ * FQuantizedPointCodec의 격자 단위로 저장한 두 점의 차이
+ */
 USTRUCT()
-struct FNumberedVector2DArray
+struct FQuantizedPointDelta
 {
 	GENERATED_BODY()
 
 	UPROPERTY()
-	int32 Number = 0;
+	FIntPoint Delta = FIntPoint::ZeroValue;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+	{
+		FQuantizedPointCodec::SerializeDelta(Ar, FIntPoint{0, 0}, Delta);
+		bOutSuccess = !Ar.IsError();
+		return true;
+	}
+};
+
+template <>
+struct TStructOpsTypeTraits<FQuantizedPointDelta> : public TStructOpsTypeTraitsBase2<FQuantizedPointDelta>
+{
+	enum { WithNetSerializer = true };
+};
+
+
+class UReplicatedTracerPathComponent;
+struct FPathTailArray;
+
+/**
+ * 경로 꼬리의 점 하나
+ *
+ * 점은 바로 앞 점에 대한 차이로 저장하므로 (첫 점은 원점에 대한 차이) 이웃한 점들끼리는 축마다 1~2바이트면 보낼 수 있습니다.
+ * 패킷 손실로 점들이 순서대로 도착하지 않을 수 있으므로 Index로 순서를 맞추고
+ * 경로가 비워질 때마다 Generation이 증가하므로 이전 경로의 점이 늦게 도착해도 구분할 수 있음
+ */
+USTRUCT()
+struct FPathTailItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Generation = 0;
 
 	UPROPERTY()
-	TArray<FOptionalVector2D> PathTail;
+	int32 Index = 0;
+
+	UPROPERTY()
+	FQuantizedPointDelta Point;
+
+	void PreReplicatedRemove(const FPathTailArray& InArraySerializer);
+	void PostReplicatedAdd(const FPathTailArray& InArraySerializer);
+};
+
+
+/**
+ * 경로 꼬리를 복제하는 Fast Array
+ *
+ * 서버는 점을 끝에 추가하거나 전부 지우기만 하므로 매 Network Frequency마다 배열 전체를 비교하지 않고 Dirty로 표시한 점들만 보냅니다.
+ * 클라이언트는 도착한 점마다 콜백을 받으므로 배열을 훑으면서 빈 원소를 찾을 필요가 없음
+ */
+USTRUCT()
+struct FPathTailArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FPathTailItem> Items;
+
+	UReplicatedTracerPathComponent* Owner = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FastArrayDeltaSerialize<FPathTailItem, FPathTailArray>(Items, DeltaParms, *this);
+	}
+};
+
+template <>
+struct TStructOpsTypeTraits<FPathTailArray> : public TStructOpsTypeTraitsBase2<FPathTailArray>
+{
+	enum { WithNetDeltaSerializer = true };
 };
 
 
@@ -121,10 +227,25 @@ private:
 	FOptionalVector2D RepPathHead;
 	TLiveData<TOptional<FVector2D>> PathHead;
 
-	UPROPERTY(ReplicatedUsing=OnRep_PathTail)
-	FNumberedVector2DArray RepPathTail;
+	UPROPERTY(Replicated)
+	FPathTailArray RepPathTail;
 	TLiveData<TArray<FVector2D>> PathTail;
 
+	/**
+	 * 서버에서는 지금 경로의 번호, 클라이언트에서는 받아들이고 있는 경로의 번호
+	 */
+	int32 TailGeneration = 0;
+
+	/**
+	 * 서버에서는 RepPathTail에 마지막으로 넣은 점, 클라이언트에서는 PathTail에 마지막으로 추가한 점의 격자 좌표
+	 */
+	FIntPoint QuantizedTailEnd = FIntPoint::ZeroValue;
+
+	/**
+	 * 앞의 점이 아직 도착하지 않아서 PathTail에 추가하지 못한 점들 (Index -> 앞 점에 대한 차이)
+	 */
+	TMap<int32, FIntPoint> PendingTailPoints;
+
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override
 	{
 		Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -138,36 +259,48 @@ private:
 		PathHead = RepPathHead.bSet ? TOptional{RepPathHead.Vector2D} : TOptional<FVector2D>{};
 	}
 
-	UFUNCTION()
-	void OnRep_PathTail(const FNumberedVector2DArray& Old)
-	{
-		// 여기 코드에 대한 설명
-		// TArray는 Replication 시 각 Element가 다른 UPROPERTY라고 생각하면 됨
-		// 즉 서버에서 0번 인덱스 업데이트 -> 다음 network frequency에서 1번 업데이트 했는데
-		// 0번 인덱스 업데이트 한 패킷이 소실되고 경우 1번만 클라이언트에 도착하면 array size는 1로 늘어남
-		// 하지만 0번 위치의 원소 값이 없기 때문에 그냥 default initialize처리하고 나중에 세팅함
-		// Path의 경우에는 1번이 있기 전에 0번이 반드시 있어야 하므로 default initialize된 것을 만나면 일단 중단한다
-		if (RepPathTail.Number == Old.Number)
+	friend struct FPathTailItem;
+
+	void OnTailItemAdded(const FPathTailItem& Item)
+	{
+		if (Item.Generation < TailGeneration)
 		{
-			for (int32 i = PathTail.Get().Num(); i < RepPathTail.PathTail.Num(); i++)
-			{
-				if (!RepPathTail.PathTail[i].bSet)
-				{
-					break;
-				}
+			return;
+		}
 
-				PathTail.Add(RepPathTail.PathTail[i].Vector2D);
-			}
+		if (Item.Generation > TailGeneration)
+		{
+			ResetClientTail(Item.Generation);
 		}
-		// 넘버가 바뀌는 경우에는 같은 틱에서 모든 원소를 세팅하므로 클라이언트에 항상 같이 옴
-		// 그러므로 위와 같은 처리가 필요하지 않음 (이해 안 되면 파일 최상단의 설명 참고)
-		else
+
+		PendingTailPoints.Add(Item.Index, Item.Point.Delta);
+
+		// 앞의 점들이 모두 도착한 점들만 차례로 추가함
+		while (const FIntPoint* Next = PendingTailPoints.Find(PathTail.Get().Num()))
+		{
+			QuantizedTailEnd += *Next;
+			PendingTailPoints.Remove(PathTail.Get().Num());
+			PathTail.Add(FQuantizedPointCodec::Dequantize(QuantizedTailEnd));
+		}
+	}
+
+	void OnTailItemRemoved(const FPathTailItem& Item)
+	{
+		// 서버는 경로가 끝날 때만 점을 지우므로 지금 경로의 점이 지워지면 다음 경로가 시작된 것
+		if (Item.Generation >= TailGeneration)
+		{
+			ResetClientTail(Item.Generation + 1);
+		}
+	}
+
+	void ResetClientTail(int32 NewGeneration)
+	{
+		TailGeneration = NewGeneration;
+		QuantizedTailEnd = FIntPoint::ZeroValue;
+		PendingTailPoints.Empty();
+		if (!PathTail.Get().IsEmpty())
 		{
 			PathTail.Empty();
-			for (const FOptionalVector2D& Each : RepPathTail.PathTail)
-			{
-				PathTail.Add(Each.Vector2D);
-			}
 		}
 	}
 
@@ -180,6 +313,14 @@ private:
 		SetIsReplicatedByDefault(true);
 	}
 
+	virtual void PostInitProperties() override
+	{
+		Super::PostInitProperties();
+
+		// 구조체가 Archetype에서 통째로 복사되므로 생성자가 아니라 여기서 설정
+		RepPathTail.Owner = this;
+	}
+
 	virtual void InitializeComponent() override
 	{
 		Super::InitializeComponent();
@@ -208,12 +349,39 @@ private:
 
 				while (auto NextPoint = co_await Stream)
 				{
-					RepPathTail.PathTail.Add(NextPoint.GetResult());
+					const FIntPoint Quantized = FQuantizedPointCodec::Quantize(NextPoint.GetResult());
+
+					FPathTailItem& Item = RepPathTail.Items.AddDefaulted_GetRef();
+					Item.Generation = TailGeneration;
+					Item.Index = RepPathTail.Items.Num() - 1;
+					Item.Point.Delta = Quantized - QuantizedTailEnd;
+					RepPathTail.MarkItemDirty(Item);
+
+					QuantizedTailEnd = Quantized;
 				}
 
-				RepPathTail.Number++;
-				RepPathTail.PathTail.Empty();
+				TailGeneration++;
+				QuantizedTailEnd = FIntPoint::ZeroValue;
+				RepPathTail.Items.Empty();
+				RepPathTail.MarkArrayDirty();
 			}
 		});
 	}
 };
+
+
+inline void FPathTailItem::PreReplicatedRemove(const FPathTailArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnTailItemRemoved(*this);
+	}
+}
+
+inline void FPathTailItem::PostReplicatedAdd(const FPathTailArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnTailItemAdded(*this);
+	}
+}
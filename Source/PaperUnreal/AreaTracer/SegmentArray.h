@@ -3,8 +3,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "CopyOnWriteArray.h"
+#include "SegmentArrayKernels.h"
+#include "SegmentSpatialIndex.h"
+#include "SegmentSweep.h"
 #include "SegmentTypes.h"
-#include "Algo/Accumulate.h"
+#include "Algo/AnyOf.h"
 #include "Algo/MaxElement.h"
 #include "PaperUnreal/GameFramework2/Utils.h"
 
@@ -24,7 +28,17 @@ struct FRay2D
 	 */
 	TOptional<std::tuple<double, double>> RayTrace(const UE::Geometry::FSegment2d& Segment) const
 	{
-		const FVector2D SegmentLengthedDirection = Segment.Direction * Segment.Length();
+		return RayTrace(Segment.StartPoint(), Segment.EndPoint());
+	}
+
+	/**
+	 * Ray와 SegmentStart에서 SegmentEnd로 가는 Segment가 충돌하는지 검사합니다
+	 *
+	 * @return 충돌했으면 레이 위의 거리와 Segment 위의 알파를 std::tuple로 반환
+	 */
+	TOptional<std::tuple<double, double>> RayTrace(const FVector2D& SegmentStart, const FVector2D& SegmentEnd) const
+	{
+		const FVector2D SegmentLengthedDirection = SegmentEnd - SegmentStart;
 		const double RayDirCrossSegDir = FVector2D::CrossProduct(Direction, SegmentLengthedDirection);
 
 		if (FMath::IsNearlyZero(RayDirCrossSegDir))
@@ -32,7 +46,7 @@ struct FRay2D
 			return {};
 		}
 
-		const FVector2D OriginToSegStart = Segment.StartPoint() - Origin;
+		const FVector2D OriginToSegStart = SegmentStart - Origin;
 		const double T = FVector2D::CrossProduct(OriginToSegStart, SegmentLengthedDirection) / RayDirCrossSegDir;
 		const double U = FVector2D::CrossProduct(OriginToSegStart, Direction) / RayDirCrossSegDir;
 
@@ -125,6 +139,131 @@ struct FSegment2D : UE::Geometry::FSegment2d
 };
 
 
+/**
+ * 두 끝점으로만 나타낸 2차원 Segment
+ *
+ * FSegment2D는 중심, 단위 방향, 길이의 절반으로 저장되므로 만들 때마다 제곱근과 나눗셈을 하고 끝점을 꺼낼 때도 다시 계산합니다.
+ * TSegmentArray2D가 내부에서 Segment를 대량으로 훑을 때는 이 클래스를 사용해서 배열의 점들을 그대로 계산에 씁니다.
+ * 알파는 FSegment2D와 같이 시작점에서 0, 끝점에서 1입니다.
+ */
+struct FRawSegment2D
+{
+	FVector2D Start;
+	FVector2D End;
+
+	/**
+	 * 정규화하지 않은 방향 (시작점에서 끝점으로 가는 벡터)
+	 */
+	FVector2D Vector() const
+	{
+		return End - Start;
+	}
+
+	double SquaredLength() const
+	{
+		return Vector().SquaredLength();
+	}
+
+	FVector2D Center() const
+	{
+		return (Start + End) * 0.5;
+	}
+
+	FVector2D PointBetween(double Alpha) const
+	{
+		return Start + Vector() * Alpha;
+	}
+
+	/**
+	 * Vector()와 시작점에서 Point로 가는 벡터의 외적을 반환합니다.
+	 * 부호가 Point가 Segment의 어느 쪽에 있는지를 나타내고 0이면 Point가 Segment를 연장한 직선 위에 있음
+	 */
+	double Orientation(const FVector2D& Point) const
+	{
+		return FVector2D::CrossProduct(Vector(), Point - Start);
+	}
+
+	/**
+	 * Point를 Segment 위에 정사영한 지점의 알파를 반환합니다. 길이가 0이면 0을 반환합니다.
+	 */
+	double ProjectUnitRange(const FVector2D& Point) const
+	{
+		const FVector2D Direction = Vector();
+		const double LengthSquared = Direction.SquaredLength();
+		if (LengthSquared <= 0.)
+		{
+			return 0.;
+		}
+
+		return FMath::Clamp(FVector2D::DotProduct(Point - Start, Direction) / LengthSquared, 0., 1.);
+	}
+
+	/**
+	 * Segment 위에서 Point와 가장 가까운 지점까지의 거리의 제곱을 반환합니다.
+	 */
+	double SquaredDistanceTo(const FVector2D& Point) const
+	{
+		return FVector2D::DistSquared(PointBetween(ProjectUnitRange(Point)), Point);
+	}
+
+	/**
+	 * 두 Segment 사이의 최단 거리의 제곱을 반환합니다. 교차하면 0입니다.
+	 */
+	double SquaredDistanceTo(const FRawSegment2D& Other) const
+	{
+		if (Intersects(Other))
+		{
+			return 0.;
+		}
+
+		// 교차하지 않으면 최단 거리는 항상 어느 한 쪽의 끝점에서 발생함
+		return FMath::Min(
+			FMath::Min(SquaredDistanceTo(Other.Start), SquaredDistanceTo(Other.End)),
+			FMath::Min(Other.SquaredDistanceTo(Start), Other.SquaredDistanceTo(End)));
+	}
+
+	/**
+	 * 이 Segment와 파라미터로 주어진 Segment의 교차지점을 이 Segment 위의 알파로 반환합니다.
+	 * FMath::SegmentIntersection2D와 같은 식을 사용하므로 교차 여부 판정도 같음
+	 */
+	TOptional<float> Intersects(const FRawSegment2D& Other) const
+	{
+		const FVector2D OtherDirection = Other.Vector();
+		const FVector2D Direction = Vector();
+		const FVector2D StartToOtherStart = Other.Start - Start;
+		const double Denominator = -Direction.X * OtherDirection.Y + OtherDirection.X * Direction.Y;
+		const double Alpha = (-OtherDirection.Y * StartToOtherStart.X + OtherDirection.X * StartToOtherStart.Y) / Denominator;
+		const double OtherAlpha = (Direction.X * StartToOtherStart.Y - Direction.Y * StartToOtherStart.X) / Denominator;
+
+		// 평행하면 Denominator가 0이라 NaN이나 무한대가 되고 아래 비교는 모두 실패함
+		if (Alpha >= 0. && Alpha <= 1. && OtherAlpha >= 0. && OtherAlpha <= 1.)
+		{
+			return static_cast<float>(Alpha);
+		}
+
+		return {};
+	}
+
+	FBox2D Bounds() const
+	{
+		return {
+			FVector2D{FMath::Min(Start.X, End.X), FMath::Min(Start.Y, End.Y)},
+			FVector2D{FMath::Max(Start.X, End.X), FMath::Max(Start.Y, End.Y)},
+		};
+	}
+
+	FSegment2D ToSegment() const
+	{
+		return {Start, End};
+	}
+
+	static FRawSegment2D FromSegment(const UE::Geometry::FSegment2d& Segment)
+	{
+		return {Segment.StartPoint(), Segment.EndPoint()};
+	}
+};
+
+
 template <bool>
 class TSegmentArray2D;
 
@@ -150,6 +289,13 @@ concept CLoopedSegmentArray2D = std::is_convertible_v<T, FLoopedSegmentArray2D>;
 /**
  * FSegment2D들의 배열
  * 내부적으로 TArray이며 Segment들에 대한 여러가지 편의 함수들을 제공합니다.
+ *
+ * Segment가 많아지면 점들을 한꺼번에 훑는 계산에 점들의 SoA 사본(FSegmentArraySoA)과 SIMD 커널을 사용하고
+ * 교차 검사와 최단 거리 검색에 FSegmentSpatialIndex2D를 사용합니다.
+ * 둘 다 쿼리 시점에 필요하면 만들어지고 배열이 복사될 때 복사본과 공유되며 배열이 수정되면 고쳐지거나 버려집니다.
+ * 이들을 사용해도 쿼리 결과는 모든 Segment를 순서대로 검사했을 때와 같습니다.
+ *
+ * 넓이와 Bounding Box는 한 번 계산하면 저장해두고 점들이 바뀔 때 바뀐 점들만 보고 고쳐두므로 다시 읽을 때는 O(1)입니다.
  * 
  * @tparam bLoop 시작점과 끝점을 이어붙일 것인지 여부
  */
@@ -174,10 +320,33 @@ public:
 		 */
 		FVector2D Location(const TSegmentArray2D& Array) const
 		{
-			return Array[SegmentIndex].PointBetween(Alpha);
+			return Array.GetRawSegment(SegmentIndex).PointBetween(Alpha);
 		}
 	};
 
+	/**
+	 * 다른 Segment 배열 (이하 Path)과 이 배열의 교차지점
+	 */
+	struct FPathIntersection
+	{
+		/**
+		 * Path 내의 Segment 인덱스
+		 */
+		int32 PathSegmentIndex;
+
+		/**
+		 * Path Segment의 시작점에서 교차지점까지의 거리
+		 */
+		double DistanceAlongPathSegment;
+
+		/**
+		 * 이 배열 상의 교차지점
+		 */
+		FIntersection Intersection;
+
+		FVector2D Point;
+	};
+
 	TSegmentArray2D(const TArray<FVector2D>& InitPoints = {})
 		: Points(InitPoints)
 	{
@@ -188,6 +357,42 @@ public:
 	{
 	}
 
+	TSegmentArray2D(const TSegmentArray2D&) = default;
+	TSegmentArray2D& operator=(const TSegmentArray2D&) = default;
+
+	/**
+	 * 이동된 배열은 비어있으므로 저장해둔 것들도 같이 버림
+	 * (TOptional은 이동해도 값이 남아있기 때문에 그대로 두면 빈 배열에 예전 Bounding Box가 남음)
+	 */
+	TSegmentArray2D(TSegmentArray2D&& Other)
+		: Points(MoveTemp(Other.Points))
+		, PointsSoA(MoveTemp(Other.PointsSoA))
+		, SpatialIndex(MoveTemp(Other.SpatialIndex))
+		, UnindexedQueryCount(Other.UnindexedQueryCount)
+		, CachedSignedDoubleArea(MoveTemp(Other.CachedSignedDoubleArea))
+		, CachedBoundingBox(MoveTemp(Other.CachedBoundingBox))
+	{
+		Other.Points.Empty();
+		Other.InvalidateCaches();
+	}
+
+	TSegmentArray2D& operator=(TSegmentArray2D&& Other)
+	{
+		if (this != &Other)
+		{
+			Points = MoveTemp(Other.Points);
+			PointsSoA = MoveTemp(Other.PointsSoA);
+			SpatialIndex = MoveTemp(Other.SpatialIndex);
+			UnindexedQueryCount = Other.UnindexedQueryCount;
+			CachedSignedDoubleArea = MoveTemp(Other.CachedSignedDoubleArea);
+			CachedBoundingBox = MoveTemp(Other.CachedBoundingBox);
+
+			Other.Points.Empty();
+			Other.InvalidateCaches();
+		}
+		return *this;
+	}
+
 	/**
 	 * Point 배열에 대해 파이썬과 같은 마이너스 기반 인덱스를 C++ 양의 인덱스로 변환합니다. 
 	 */
@@ -210,7 +415,7 @@ public:
 	 */
 	const TArray<FVector2D>& GetPoints() const
 	{
-		return Points;
+		return Points.Get();
 	}
 
 	/**
@@ -293,7 +498,16 @@ public:
 	 */
 	void AddPoint(const FVector2D& Position)
 	{
-		Points.Add(Position);
+		SpliceCachedProperties(Points.Num(), 0, MakeArrayView(&Position, 1));
+		Points.Mutable().Add(Position);
+		UpdatePointsSoA(Points.Num() - 1);
+
+		// 기존 마지막 Segment(Loop이면 닫는 Segment)가 바뀌고 새 Segment가 하나 생김
+		if constexpr (bLoop)
+		{
+			MarkSegmentDirty(SegmentCount() - 2);
+		}
+		MarkSegmentDirty(SegmentCount() - 1);
 	}
 
 	/**
@@ -301,7 +515,14 @@ public:
 	 */
 	void SetPoint(int32 Index, const FVector2D& NewPosition)
 	{
-		Points[PositivePointIndex(Index)] = NewPosition;
+		Index = PositivePointIndex(Index);
+		SpliceCachedProperties(Index, 1, MakeArrayView(&NewPosition, 1));
+		Points.Mutable()[Index] = NewPosition;
+		UpdatePointsSoA(Index);
+
+		// 이 점을 끝점으로 하는 Segment와 시작점으로 하는 Segment가 바뀜
+		MarkSegmentDirty(bLoop && Index == 0 ? SegmentCount() - 1 : Index - 1);
+		MarkSegmentDirty(Index < SegmentCount() ? Index : INDEX_NONE);
 	}
 
 	/**
@@ -313,7 +534,10 @@ public:
 	{
 		if (!NewPoints.IsEmpty())
 		{
-			Points.Insert(NewPoints.GetData(), NewPoints.Num(), PositivePointIndex(Index));
+			Index = PositivePointIndex(Index);
+			SpliceCachedProperties(Index, 0, NewPoints);
+			Points.Mutable().Insert(NewPoints.GetData(), NewPoints.Num(), Index);
+			InvalidateIndexedCaches();
 		}
 	}
 
@@ -337,7 +561,9 @@ public:
 	 */
 	void RemovePoints(int32 StartIndex, int32 LastIndex)
 	{
-		Points.RemoveAt(StartIndex, LastIndex - StartIndex + 1);
+		SpliceCachedProperties(StartIndex, LastIndex - StartIndex + 1, {});
+		Points.Mutable().RemoveAt(StartIndex, LastIndex - StartIndex + 1);
+		InvalidateIndexedCaches();
 	}
 
 	/**
@@ -377,11 +603,20 @@ public:
 	 */
 	float CalculateArea() const requires bLoop
 	{
-		// Shoelace formula
-		return 0.5f * FMath::Abs(Algo::TransformAccumulate(*this, [](const FSegment2D& Segment)
+		return static_cast<float>(FMath::Abs(CalculateSignedArea()));
+	}
+
+	/**
+	 * Segment들이 이루는 영역의 부호 있는 넓이를 반환합니다. IsClockwise가 true이면 양수입니다.
+	 */
+	double CalculateSignedArea() const requires bLoop
+	{
+		if (!CachedSignedDoubleArea)
 		{
-			return Segment.StartPoint().X * Segment.EndPoint().Y - Segment.StartPoint().Y * Segment.EndPoint().X;
-		}, 0.f));
+			CachedSignedDoubleArea = CalculateSignedDoubleAreaFromScratch();
+		}
+
+		return 0.5 * *CachedSignedDoubleArea;
 	}
 
 	/**
@@ -389,7 +624,36 @@ public:
 	 */
 	FBox2D CalculateBoundingBox() const
 	{
-		return {Points};
+		if (!CachedBoundingBox)
+		{
+			const FSegmentArraySoA* SoA = FindPointsSoA();
+			CachedBoundingBox = SoA ? SegmentArrayKernels::CalculateBoundingBox(*SoA) : FBox2D{Points.Get()};
+		}
+
+		return *CachedBoundingBox;
+	}
+
+	/**
+	 * 쿼리할 때 필요해지면 만드는 캐시들(SoA 사본, 공간 인덱스, 넓이, Bounding Box)을 지금 모두 만듭니다.
+	 * 캐시를 만드는 도중에 다른 스레드가 읽으면 안 되므로 여러 스레드에서 같은 배열을 동시에 쿼리하기 전에 호출해야 합니다.
+	 * 호출한 이후로 배열을 수정하지 않는 동안에는 const 함수들이 아무것도 수정하지 않습니다.
+	 */
+	void WarmCaches() const
+	{
+		FindPointsSoA();
+
+		if (SegmentCount() >= SpatialIndexMinSegmentCount)
+		{
+			UnindexedQueryCount = SpatialIndexBuildQueryCount;
+			FindSpatialIndex();
+		}
+
+		CalculateBoundingBox();
+
+		if constexpr (bLoop)
+		{
+			CalculateSignedArea();
+		}
 	}
 
 	/**
@@ -400,17 +664,33 @@ public:
 
 	/**
 	 * Segment들이 대체로 시계방향을 이루는지 여부
+	 * Loop인 경우에는 영역의 부호 있는 넓이로 판단하므로 O(1)입니다.
 	 */
 	bool IsClockwise() const
 	{
-		return CalculateNetAngleDelta() > 0.f;
+		if constexpr (bLoop)
+		{
+			return CalculateSignedArea() > 0.;
+		}
+		else
+		{
+			return CalculateNetAngleDelta() > 0.f;
+		}
 	}
 
 	/**
 	 * 파라미터로 주어진 점이 Segment들이 이루는 영역 안에 존재하는지 여부를 반환합니다.
+	 * 경계 위의 점은 안쪽에 있는 것으로 취급합니다.
 	 */
 	bool IsInside(const FVector2D& Point) const requires bLoop;
 
+	/**
+	 * 여러 점에 대해 IsInside를 한 번에 검사합니다. Segment들을 한 번만 훑으므로 점마다 IsInside를 호출하는 것보다 빠릅니다.
+	 *
+	 * @param OutResults Points와 같은 길이여야 하며 각 점의 IsInside 결과가 같은 위치에 기록됨
+	 */
+	void IsInside(TArrayView<const FVector2D> Points, TArrayView<bool> OutResults) const requires bLoop;
+
 	/**
 	 * 파라미터로 주어진 Segment 배열이 이 배열의 Segment들이 이루는 영역 안에 존재하는지 여부를 반환합니다.
 	 */
@@ -419,18 +699,61 @@ public:
 	/**
 	 * 파라미터로 주어진 점과 가장 가까운 Segment 상의 점을 반환합니다.
 	 */
-	FIntersection FindClosestPointTo(const FVector2D& Point) const;
+	FIntersection FindClosestPointTo(const FVector2D& Point) const
+	{
+		return FindClosestPointWithinSquared(Point, TNumericLimits<double>::Max()).Get(FIntersection{});
+	}
+
+	/**
+	 * 파라미터로 주어진 점에서 MaxDistance 이내에 있는 Segment 상의 점 중에서 가장 가까운 점을 반환합니다.
+	 * 공간 인덱스가 있으면 MaxDistance보다 먼 노드는 방문하지 않으므로 반경이 작을수록 빠릅니다.
+	 */
+	TOptional<FIntersection> FindClosestPointWithin(const FVector2D& Point, double MaxDistance) const
+	{
+		return FindClosestPointWithinSquared(Point, MaxDistance * MaxDistance);
+	}
+
+	/**
+	 * 파라미터로 주어진 점과 가까운 순서대로 최대 Count개의 Segment에 대해 각 Segment 상의 가장 가까운 점을 반환합니다.
+	 * 거리가 같으면 인덱스가 작은 Segment가 먼저 옵니다.
+	 */
+	TArray<FIntersection> FindClosestPointsTo(const FVector2D& Point, int32 Count) const;
 
 	/**
 	 * 파라미터로 주어진 Segment와의 교차지점 중에서 아무거나 반환합니다.
 	 */
-	TOptional<FIntersection> FindIntersection(const UE::Geometry::FSegment2d& Segment) const;
+	TOptional<FIntersection> FindIntersection(const FRawSegment2D& Segment) const;
+
+	TOptional<FIntersection> FindIntersection(const UE::Geometry::FSegment2d& Segment) const
+	{
+		return FindIntersection(FRawSegment2D::FromSegment(Segment));
+	}
 
 	/**
 	 * 파라미터로 주어진 Segment와의 교차지점을 모두 반환합니다.
 	 * 평행인 Segment가 있어서 교차지점이 무수히 많을 경우 그 중에서 하나만 반환합니다.
 	 */
-	TArray<FIntersection> FindAllIntersections(const UE::Geometry::FSegment2d& Segment) const;
+	TArray<FIntersection> FindAllIntersections(const FRawSegment2D& Segment) const;
+
+	TArray<FIntersection> FindAllIntersections(const UE::Geometry::FSegment2d& Segment) const
+	{
+		return FindAllIntersections(FRawSegment2D::FromSegment(Segment));
+	}
+
+	/**
+	 * 파라미터로 주어진 Segment와 교차하거나 Distance 이내로 가까이 지나가는 Segment가 하나라도 있는지 반환합니다.
+	 * 교차 검사만으로는 꼭짓점을 정확히 지나는 경우 floating point 오차로 양쪽 Segment 모두 교차하지 않는다고 나올 수 있으므로
+	 * 경계를 넘었는지를 놓치면 안 되는 곳에서는 이 함수를 사용해야 합니다.
+	 */
+	bool IsNear(const FRawSegment2D& Segment, double Distance) const;
+
+	/**
+	 * 파라미터로 주어진 Path의 모든 Segment와의 교차지점을 Path를 따라가는 순서대로 반환합니다.
+	 * Path의 Segment마다 FindAllIntersections를 호출한 것과 결과는 같지만 두 배열을 x축으로 한 번에 훑어서
+	 * AABB가 겹치는 Segment 쌍만 검사하므로 O((n + m) log(n + m) + k)에 찾습니다.
+	 */
+	template <bool bPathLoop>
+	TArray<FPathIntersection> FindAllIntersectionsAlong(const TSegmentArray2D<bPathLoop>& Path) const;
 
 	/**
 	 * 파라미터로 주어진 점을 파라미터로 주어진 방향으로 이동시킬 때
@@ -443,6 +766,45 @@ public:
 	 */
 	UE::Geometry::FSegment2d Clip(const UE::Geometry::FSegment2d& Segment) const requires bLoop;
 
+	/**
+	 * Path의 양 끝 중 영역 밖에 있으면서 경계와의 거리가 MaxDistance 이내인 끝에 경계 위의 가장 가까운 점을 이어붙입니다.
+	 *
+	 * 경계 위에서 시작한 Path라도 그 사이에 경계가 Simplify로 움직였으면 끝이 경계 밖에 떨어져 있어서 Union이 교차 지점을 찾지 못하는데
+	 * 이어붙인 점은 경계 위에 있으므로 다시 교차 지점을 찾을 수 있게 됨
+	 */
+	void AttachPathEnds(FSegmentArray2D& Path, double MaxDistance) const requires bLoop
+	{
+		if (!IsValid() || !Path.IsValid())
+		{
+			return;
+		}
+
+		const auto FindAttachedPoint = [&](const FVector2D& End) -> TOptional<FVector2D>
+		{
+			if (IsInside(End))
+			{
+				return {};
+			}
+
+			const FVector2D Closest = FindClosestPointTo(End).Location(*this);
+			if (FVector2D::DistSquared(Closest, End) > MaxDistance * MaxDistance)
+			{
+				return {};
+			}
+			return Closest;
+		};
+
+		if (TOptional<FVector2D> Attached = FindAttachedPoint(Path.GetPoint(-1)))
+		{
+			Path.AddPoint(*Attached);
+		}
+
+		if (TOptional<FVector2D> Attached = FindAttachedPoint(Path.GetPoint(0)))
+		{
+			Path.InsertPoints(0, {*Attached});
+		}
+	}
+
 	/**
 	 * 이 Segment 배열이 이루는 영역과 파라미터로 주어진 Segment 배열이 교차하여 이루는 새 영역들을 포함하도록 Segment 배열을 수정합니다.
 	 *
@@ -462,18 +824,44 @@ public:
 	/**
 	 * Union과 비슷한 방식으로 Path가 Area에 안쪽으로 교차한 부분을 영역에서 잘라냅니다.
 	 * 잘라낸 부분이 있는지 여부만 반환합니다.
+	 *
+	 * Path가 영역을 여러 번 가로지르면 영역이 여러 섬으로 쪼개지는데 그 중 가장 넓은 섬만 남깁니다.
+	 * 영역을 복사해서 잘라보는 대신 경계를 한 번 훑어서 모든 섬의 넓이를 구한 뒤 남길 섬을 만드는 자르기만 실제로 적용합니다.
+	 *
+	 * @param OutDiscardedIslands nullptr가 아니면 잘라내서 버려진 섬들을 추가함 (잘라낸 부분이 없으면 아무것도 추가하지 않음)
 	 */
 	template <CSegmentArray2D SegmentArrayType>
-	bool Difference(SegmentArrayType&& Path) requires bLoop;
+	bool Difference(SegmentArrayType&& Path, TArray<TSegmentArray2D<true>>* OutDiscardedIslands = nullptr) requires bLoop;
+
+	/**
+	 * 제거해도 모양이 거의 바뀌지 않는 점들을 제거해서 점의 개수를 줄입니다.
+	 *
+	 * 제거했을 때 생기는 오차가 가장 작은 점부터 하나씩 제거합니다. (Visvalingam 방식이지만 넓이 대신 거리를 오차로 사용)
+	 * 오차는 지금까지 제거된 모든 점들과 새로 이어지는 Segment 사이의 거리의 상한이므로 원래 경계에서 MaxError보다 멀어지지 않습니다.
+	 * 점을 제거해서 새로 이어지는 Segment가 다른 Segment와 교차하게 되는 경우에는 제거하지 않으므로 스스로 교차하는 영역이 만들어지지 않습니다.
+	 *
+	 * @param MaxError 단순화된 경계가 원래 경계에서 벗어날 수 있는 최대 거리
+	 * @param MaxPointCount 0보다 크면 점의 개수가 이 이하가 될 때까지는 MaxError를 넘더라도 오차가 작은 점부터 계속 제거함
+	 * @return 제거한 점의 개수
+	 */
+	int32 Simplify(float MaxError, int32 MaxPointCount = 0) requires bLoop;
 
 	void ReverseVertexOrder()
 	{
-		std::reverse(Points.begin(), Points.end());
+		TArray<FVector2D>& MutablePoints = Points.Mutable();
+		std::reverse(MutablePoints.begin(), MutablePoints.end());
+		InvalidateIndexedCaches();
+
+		if (CachedSignedDoubleArea)
+		{
+			CachedSignedDoubleArea = -*CachedSignedDoubleArea;
+		}
 	}
 
 	void Empty()
 	{
 		Points.Empty();
+		InvalidateCaches();
 	}
 
 	/**
@@ -482,10 +870,11 @@ public:
 	template <typename FuncType>
 	void ApplyToEachPoint(FuncType&& Func)
 	{
-		for (auto& Each : Points)
+		for (auto& Each : Points.Mutable())
 		{
 			Func(Each);
 		}
+		InvalidateCaches();
 	}
 
 	FSegmentArray2D SubArray(int32 FirstSegmentIndex, int32 LastSegmentIndex) const
@@ -508,6 +897,20 @@ public:
 		};
 	}
 
+	/**
+	 * Index 위치의 Segment를 끝점 두 개로 반환합니다.
+	 * operator[]와 달리 정규화를 하지 않으므로 Segment를 많이 훑는 계산에는 이 함수를 사용하는 것이 좋습니다.
+	 */
+	FRawSegment2D GetRawSegment(int32 Index) const
+	{
+		Index = PositiveSegmentIndex(Index);
+		return
+		{
+			Points[SegmentIndexToStartPointIndex(Index)],
+			Points[SegmentIndexToEndPointIndex(Index)],
+		};
+	}
+
 	class FSegmentConstIterator
 	{
 	public:
@@ -554,62 +957,561 @@ public:
 		return {this, SegmentCount()};
 	}
 
-private:
-	TArray<FVector2D> Points;
-
-	void ReplacePointsNoLoop(int32 FirstIndex, int32 LastIndex, TArrayView<const FVector2D> NewPoints)
+	class FRawSegmentConstIterator
 	{
-		const int32 Count = FMath::Min(LastIndex - FirstIndex + 1, Points.Num());
-		Points.RemoveAt(FirstIndex, Count);
-		InsertPoints(FirstIndex, NewPoints);
-	}
+	public:
+		using value_type = FRawSegment2D;
 
-	void ReplacePointsBySegmentIndices(int32 StartSegment, int32 EndSegment, const TArray<FVector2D>& NewPoints)
-	{
-		if (StartSegment == EndSegment)
+		FRawSegmentConstIterator(const TSegmentArray2D* InOrigin, int32 Index)
+			: Origin(InOrigin), CurrentIndex(Index)
 		{
-			InsertPoints(SegmentIndexToEndPointIndex(StartSegment), NewPoints);
 		}
-		else
+
+		value_type operator*() const
 		{
-			ReplacePoints(
-				SegmentIndexToEndPointIndex(StartSegment),
-				SegmentIndexToStartPointIndex(EndSegment),
-				NewPoints);
+			return Origin->GetRawSegment(CurrentIndex);
 		}
-	};
 
-	/**
-	 * Path를 2번 교차하는 Path들로 쪼개서 반환합니다.
-	 * 예를 들어 영역에서 나갔다 들어왔다 나간 경우 (나감-들어옴), (들어옴-나감)의 두 부분으로 쪼개서 반환
-	 */
-	TArray<FSegmentArray2D> SplitIntoCleanPaths(FSegmentArray2D Path);
+		FRawSegmentConstIterator& operator++()
+		{
+			CurrentIndex++;
+			return *this;
+		}
 
-	auto UnionAssumeTwoIntersections(FSegmentArray2D Path) requires bLoop;
-	void DifferenceAssumeTwoIntersections(FSegmentArray2D Path) requires bLoop;
-};
+		friend bool operator==(const FRawSegmentConstIterator& Left, const FRawSegmentConstIterator& Right)
+		{
+			return Left.CurrentIndex == Right.CurrentIndex;
+		}
 
+		friend bool operator!=(const FRawSegmentConstIterator& Left, const FRawSegmentConstIterator& Right)
+		{
+			return !(Left == Right);
+		}
 
-struct FUnionResult
-{
-	FSegmentArray2D CorrectlyAlignedPath;
-};
+	private:
+		const TSegmentArray2D* Origin;
+		int32 CurrentIndex = 0;
+	};
 
+	struct FRawSegmentRange
+	{
+		const TSegmentArray2D* Origin;
 
-template <bool bLoop>
-void TSegmentArray2D<bLoop>::ReplacePoints(int32 FirstIndex, int32 LastIndex, TArrayView<const FVector2D> NewPoints) requires bLoop
-{
-	FirstIndex = FirstIndex % FMath::Max(Points.Num(), 1);
-	LastIndex = LastIndex % FMath::Max(Points.Num(), 1);
+		FRawSegmentConstIterator begin() const
+		{
+			return {Origin, 0};
+		}
 
-	if (FirstIndex <= LastIndex)
+		FRawSegmentConstIterator end() const
+		{
+			return {Origin, Origin->SegmentCount()};
+		}
+	};
+
+	/**
+	 * range-based for로 모든 Segment를 FRawSegment2D로 순회할 때 사용합니다.
+	 *
+	 * for (const FRawSegment2D& Each : SegmentArray.RawSegments())
+	 */
+	FRawSegmentRange RawSegments() const
+	{
+		return {this};
+	}
+
+private:
+	/**
+	 * Segment가 이 개수 이상일 때만 SoA 사본과 SIMD 커널을 사용합니다.
+	 */
+	static constexpr int32 PointsSoAMinSegmentCount = 16;
+
+	/**
+	 * Segment가 이 개수 이상일 때만 공간 인덱스를 사용합니다. 이보다 적으면 그냥 다 훑는 게 빠름
+	 */
+	static constexpr int32 SpatialIndexMinSegmentCount = 64;
+
+	/**
+	 * 공간 인덱스가 없는 상태에서 이 횟수만큼 쿼리가 들어오면 인덱스를 만듭니다.
+	 * SubArray처럼 한두 번 쿼리하고 버리는 배열에 대해서는 인덱스를 만드는 비용이 선형 탐색보다 비싸기 때문
+	 */
+	static constexpr int32 SpatialIndexBuildQueryCount = 3;
+
+	/**
+	 * 복사할 때는 공유하고 수정할 때 필요하면 복사함, 배열이 값으로 이리저리 전달되어도 대부분 실제로 복사되지 않음
+	 */
+	TCopyOnWriteArray<FVector2D> Points;
+
+	mutable TSharedPtr<FSegmentArraySoA> PointsSoA;
+	mutable TSharedPtr<FSegmentSpatialIndex2D> SpatialIndex;
+	mutable int32 UnindexedQueryCount = 0;
+
+	/**
+	 * Shoelace formula의 합 (부호 있는 넓이의 두 배), Loop인 경우에만 사용
+	 */
+	mutable TOptional<double> CachedSignedDoubleArea;
+	mutable TOptional<FBox2D> CachedBoundingBox;
+
+	double CalculateSignedDoubleAreaFromScratch() const
+	{
+		if (const FSegmentArraySoA* SoA = FindPointsSoA())
+		{
+			return SegmentArrayKernels::CalculateSignedDoubleArea(*SoA);
+		}
+
+		double Ret = 0.;
+		if (!Points.IsEmpty())
+		{
+			const FVector2D* Start = &Points.Last();
+			for (const FVector2D& End : Points)
+			{
+				Ret += FVector2D::CrossProduct(*Start, End);
+				Start = &End;
+			}
+		}
+		return Ret;
+	}
+
+	/**
+	 * Index부터 RemoveCount개의 점이 NewPoints로 교체되기 직전에 호출해서 저장해둔 넓이와 Bounding Box를 고칩니다.
+	 * 넓이는 교체되는 부분의 Shoelace 항들만 빼고 더하므로 O(RemoveCount + NewPoints.Num())입니다.
+	 * Bounding Box는 경계에 걸쳐 있던 점이 제거되는 경우에만 버리고 다음에 필요할 때 새로 계산합니다.
+	 * Loop인 경우 교체되는 점들이 배열의 끝을 넘어 처음으로 이어져도 됩니다.
+	 */
+	void SpliceCachedProperties(int32 Index, int32 RemoveCount, TArrayView<const FVector2D> NewPoints)
+	{
+		const int32 PointCount = Points.Num();
+		const bool bBecomesEmpty = PointCount - RemoveCount + NewPoints.Num() == 0;
+
+		if constexpr (bLoop)
+		{
+			if (CachedSignedDoubleArea && RemoveCount < PointCount)
+			{
+				// 교체되는 점들의 앞뒤 점은 그대로 남아있으므로 앞 점에서 뒤 점까지 이어지는 체인의 항만 바뀜
+				const FVector2D& Prev = Points[(Index - 1 + PointCount) % PointCount];
+				const FVector2D& Next = Points[(Index + RemoveCount) % PointCount];
+
+				double Delta = 0.;
+				const FVector2D* Start = &Prev;
+				for (int32 i = Index; i < Index + RemoveCount; i++)
+				{
+					Delta -= FVector2D::CrossProduct(*Start, Points[i % PointCount]);
+					Start = &Points[i % PointCount];
+				}
+				Delta -= FVector2D::CrossProduct(*Start, Next);
+
+				Start = &Prev;
+				for (const FVector2D& Each : NewPoints)
+				{
+					Delta += FVector2D::CrossProduct(*Start, Each);
+					Start = &Each;
+				}
+				Delta += FVector2D::CrossProduct(*Start, Next);
+
+				*CachedSignedDoubleArea += Delta;
+			}
+			else
+			{
+				CachedSignedDoubleArea.Reset();
+			}
+		}
+
+		if (CachedBoundingBox)
+		{
+			const FBox2D& Box = *CachedBoundingBox;
+			const auto IsOnBox = [&](const FVector2D& Each)
+			{
+				return Each.X == Box.Min.X || Each.X == Box.Max.X || Each.Y == Box.Min.Y || Each.Y == Box.Max.Y;
+			};
+
+			const int32 FirstPartCount = FMath::Min(RemoveCount, PointCount - Index);
+			const bool bRemovesBoundaryPoint = bBecomesEmpty
+				|| Algo::AnyOf(MakeArrayView(Points.Get()).Slice(Index, FirstPartCount), IsOnBox)
+				|| Algo::AnyOf(MakeArrayView(Points.Get()).Slice(0, RemoveCount - FirstPartCount), IsOnBox);
+
+			if (bRemovesBoundaryPoint)
+			{
+				CachedBoundingBox.Reset();
+			}
+			else
+			{
+				for (const FVector2D& Each : NewPoints)
+				{
+					*CachedBoundingBox += Each;
+				}
+			}
+		}
+	}
+
+	/**
+	 * SIMD 커널에 넘길 점들의 SoA 사본을 반환합니다. 필요하면 이 시점에 만듭니다.
+	 * 커널을 사용하지 않는 게 나은 경우 nullptr를 반환합니다.
+	 */
+	const FSegmentArraySoA* FindPointsSoA() const
+	{
+		if (SegmentCount() < PointsSoAMinSegmentCount)
+		{
+			return nullptr;
+		}
+
+		if (!PointsSoA.IsValid())
+		{
+			PointsSoA = MakeShared<FSegmentArraySoA>();
+			PointsSoA->Build(Points.Get());
+		}
+
+		return PointsSoA.Get();
+	}
+
+	/**
+	 * 점 하나가 바뀌었거나 배열 끝에 추가되었을 때 SoA 사본을 고칩니다.
+	 */
+	void UpdatePointsSoA(int32 PointIndex)
+	{
+		if (!PointsSoA.IsValid())
+		{
+			return;
+		}
+
+		// 복사본과 공유 중인 사본은 건드리지 않고 다음에 필요할 때 새로 만듬
+		if (PointsSoA.IsUnique())
+		{
+			PointsSoA->SetPoint(PointIndex, Points[PointIndex]);
+		}
+		else
+		{
+			PointsSoA.Reset();
+		}
+	}
+
+	/**
+	 * 쿼리에 사용할 공간 인덱스를 반환합니다. 필요하면 이 시점에 인덱스를 만듭니다.
+	 * 인덱스를 사용하지 않는 게 나은 경우 nullptr를 반환합니다.
+	 */
+	const FSegmentSpatialIndex2D* FindSpatialIndex() const
+	{
+		if (SegmentCount() < SpatialIndexMinSegmentCount)
+		{
+			return nullptr;
+		}
+
+		if (SpatialIndex.IsValid() && !SpatialIndex->NeedsRebuild())
+		{
+			return SpatialIndex.Get();
+		}
+
+		if (!SpatialIndex.IsValid() && ++UnindexedQueryCount < SpatialIndexBuildQueryCount)
+		{
+			return nullptr;
+		}
+
+		// 복사본과 공유 중인 인덱스는 건드리지 않고 새로 만듬
+		if (!SpatialIndex.IsValid() || !SpatialIndex.IsUnique())
+		{
+			SpatialIndex = MakeShared<FSegmentSpatialIndex2D>();
+		}
+
+		SpatialIndex->Build(Points.Get(), bLoop);
+		return SpatialIndex.Get();
+	}
+
+	/**
+	 * Segment 하나의 모양이 바뀌었거나 배열 끝에 Segment가 추가되었을 때 공간 인덱스를 고칩니다.
+	 */
+	void MarkSegmentDirty(int32 SegmentIndex)
+	{
+		if (!SpatialIndex.IsValid() || SegmentIndex < 0)
+		{
+			return;
+		}
+
+		if (SpatialIndex.IsUnique())
+		{
+			SpatialIndex->MarkSegmentDirty(SegmentIndex);
+		}
+		else
+		{
+			SpatialIndex.Reset();
+			UnindexedQueryCount = 0;
+		}
+	}
+
+	/**
+	 * 점들의 인덱스가 밀리는 변경이 일어났을 때 SoA 사본과 공간 인덱스를 버립니다. 다음에 필요할 때 다시 만들어짐
+	 */
+	void InvalidateIndexedCaches()
+	{
+		PointsSoA.Reset();
+		SpatialIndex.Reset();
+		UnindexedQueryCount = 0;
+	}
+
+	/**
+	 * 점들이 통째로 바뀌었을 때 저장해둔 모든 것을 버립니다.
+	 */
+	void InvalidateCaches()
+	{
+		InvalidateIndexedCaches();
+		CachedSignedDoubleArea.Reset();
+		CachedBoundingBox.Reset();
+	}
+
+	/**
+	 * 공간 인덱스로 추린 후보 Segment들의 인덱스를 중복 없이 오름차순으로 반환합니다.
+	 * 오름차순으로 검사하면 모든 Segment를 처음부터 검사했을 때와 같은 결과를 얻을 수 있음
+	 */
+	template <typename GatherFuncType>
+	static TArray<int32, TInlineAllocator<32>> GatherCandidateSegments(const GatherFuncType& Gather)
+	{
+		TArray<int32, TInlineAllocator<32>> Ret;
+		Gather([&](int32 SegmentIndex) { Ret.Add(SegmentIndex); });
+		Ret.Sort();
+
+		int32 UniqueCount = 0;
+		for (int32 i = 0; i < Ret.Num(); i++)
+		{
+			if (UniqueCount == 0 || Ret[UniqueCount - 1] != Ret[i])
+			{
+				Ret[UniqueCount++] = Ret[i];
+			}
+		}
+		Ret.SetNum(UniqueCount);
+
+		return Ret;
+	}
+
+	enum class EEdgeCrossing : uint8
+	{
+		None,
+		Crossing,
+		OnEdge,
+	};
+
+	/**
+	 * Point에서 +X 방향으로 쏜 반직선이 Start에서 End로 가는 변을 가로지르는지 검사합니다. (Crossing Number 알고리즘의 한 단계)
+	 *
+	 * 반직선이 꼭짓점을 정확히 지나는 경우를 위해 변의 Y 범위를 [아래, 위)의 반열린 구간으로 취급합니다.
+	 * 이렇게 하면 꼭짓점을 지나 반대편으로 넘어가는 경우는 한 번, 꼭짓점에서 되돌아오는 경우는 0번 또는 두 번 세어지고
+	 * 반직선과 겹치는 수평인 변은 세어지지 않습니다.
+	 */
+	static EEdgeCrossing ClassifyEdgeCrossing(const FVector2D& Start, const FVector2D& End, const FVector2D& Point)
+	{
+		if (Point.Y < FMath::Min(Start.Y, End.Y) - UE_KINDA_SMALL_NUMBER
+			|| Point.Y > FMath::Max(Start.Y, End.Y) + UE_KINDA_SMALL_NUMBER)
+		{
+			return EEdgeCrossing::None;
+		}
+
+		const FVector2D Edge = End - Start;
+		const FVector2D StartToPoint = Point - Start;
+		const double Cross = FVector2D::CrossProduct(Edge, StartToPoint);
+
+		// 변 위의 점 (변과의 거리가 UE_KINDA_SMALL_NUMBER 이내)
+		if (Cross * Cross <= UE_KINDA_SMALL_NUMBER * UE_KINDA_SMALL_NUMBER * Edge.SquaredLength()
+			&& Point.X >= FMath::Min(Start.X, End.X) - UE_KINDA_SMALL_NUMBER
+			&& Point.X <= FMath::Max(Start.X, End.X) + UE_KINDA_SMALL_NUMBER)
+		{
+			return EEdgeCrossing::OnEdge;
+		}
+
+		if ((Start.Y > Point.Y) != (End.Y > Point.Y))
+		{
+			// Edge.Y가 0이 아님이 보장되므로 나눗셈 대신 부호로 교차 위치가 Point의 오른쪽인지 판단
+			if (Edge.Y > 0. ? Cross > 0. : Cross < 0.)
+			{
+				return EEdgeCrossing::Crossing;
+			}
+		}
+
+		return EEdgeCrossing::None;
+	}
+
+	/**
+	 * 거리의 제곱이 MaxDistanceSquared 이하인 Segment 상의 점 중에서 가장 가까운 점을 반환합니다.
+	 */
+	TOptional<FIntersection> FindClosestPointWithinSquared(const FVector2D& Point, double MaxDistanceSquared) const;
+
+	static FBox2D MakeBounds(const UE::Geometry::FSegment2d& Segment)
+	{
+		return FRawSegment2D::FromSegment(Segment).Bounds();
+	}
+
+	void ReplacePointsNoLoop(int32 FirstIndex, int32 LastIndex, TArrayView<const FVector2D> NewPoints)
+	{
+		const int32 Count = FMath::Min(LastIndex - FirstIndex + 1, Points.Num());
+		SpliceCachedProperties(FirstIndex, Count, NewPoints);
+		SplicePoints(FirstIndex, Count, NewPoints);
+		InvalidateIndexedCaches();
+	}
+
+	/**
+	 * Index부터 RemoveCount개의 점을 NewPoints로 교체합니다.
+	 * RemoveAt 후에 Insert를 하면 뒤쪽 점들을 두 번 옮기게 되므로 개수 차이만큼 뒤쪽 점들을 한 번만 옮긴 다음 새 점들을 덮어씀
+	 */
+	void SplicePoints(int32 Index, int32 RemoveCount, TArrayView<const FVector2D> NewPoints)
+	{
+		const int32 TailIndex = Index + RemoveCount;
+		const int32 TailCount = Points.Num() - TailIndex;
+		const int32 NewCount = Points.Num() - RemoveCount + NewPoints.Num();
+
+		// 다른 복사본과 공유 중이면 어차피 복사해야 하므로 교체된 결과를 바로 새 버퍼에 만듬
+		if (Points.IsShared())
+		{
+			TArray<FVector2D> Spliced;
+			Spliced.Reserve(NewCount);
+			Spliced.Append(Points.GetData(), Index);
+			Spliced.Append(NewPoints.GetData(), NewPoints.Num());
+			Spliced.Append(Points.GetData() + TailIndex, TailCount);
+			Points = MoveTemp(Spliced);
+			return;
+		}
+
+		TArray<FVector2D>& MutablePoints = Points.Mutable();
+
+		if (NewCount > MutablePoints.Num())
+		{
+			MutablePoints.AddUninitialized(NewCount - MutablePoints.Num());
+		}
+
+		if (NewPoints.Num() != RemoveCount && TailCount > 0)
+		{
+			FMemory::Memmove(MutablePoints.GetData() + Index + NewPoints.Num(), MutablePoints.GetData() + TailIndex, TailCount * sizeof(FVector2D));
+		}
+
+		if (NewCount < MutablePoints.Num())
+		{
+			MutablePoints.SetNum(NewCount, EAllowShrinking::No);
+		}
+
+		if (!NewPoints.IsEmpty())
+		{
+			FMemory::Memcpy(MutablePoints.GetData() + Index, NewPoints.GetData(), NewPoints.Num() * sizeof(FVector2D));
+		}
+	}
+
+	void ReplacePointsBySegmentIndices(int32 StartSegment, int32 EndSegment, const TArray<FVector2D>& NewPoints)
+	{
+		if (StartSegment == EndSegment)
+		{
+			InsertPoints(SegmentIndexToEndPointIndex(StartSegment), NewPoints);
+		}
+		else
+		{
+			ReplacePoints(
+				SegmentIndexToEndPointIndex(StartSegment),
+				SegmentIndexToStartPointIndex(EndSegment),
+				NewPoints);
+		}
+	};
+
+	/**
+	 * Path를 2번 교차하는 Path들로 쪼개서 반환합니다.
+	 * 예를 들어 영역에서 나갔다 들어왔다 나간 경우 (나감-들어옴), (들어옴-나감)의 두 부분으로 쪼개서 반환
+	 */
+	TArray<FSegmentArray2D> SplitIntoCleanPaths(FSegmentArray2D Path);
+
+	/**
+	 * FirstSegment에서 LastSegment까지 정방향으로 이어지는 호와 LastSegment에서 FirstSegment까지 정방향으로 이어지는 호의
+	 * Shoelace 항들의 합을 각각 반환합니다.
+	 * 두 호는 양 끝 Segment를 공유하고 나머지 Segment들을 나눠 가지므로 짧은 쪽만 직접 더하고 긴 쪽은 전체 합에서 구합니다.
+	 */
+	TTuple<double, double> SumShoelaceTermsOfArcs(int32 FirstSegment, int32 LastSegment) const requires bLoop
+	{
+		const int32 Count = Points.Num();
+		const auto Term = [&](int32 SegmentIndex)
+		{
+			return FVector2D::CrossProduct(Points[SegmentIndex], Points[(SegmentIndex + 1) % Count]);
+		};
+
+		if (FirstSegment == LastSegment)
+		{
+			const double Ret = Term(FirstSegment);
+			return MakeTuple(Ret, Ret);
+		}
+
+		const auto SumArc = [&](int32 StartSegment, int32 SegmentCount)
+		{
+			double Ret = 0.;
+			for (int32 i = 0; i < SegmentCount; i++)
+			{
+				Ret += Term((StartSegment + i) % Count);
+			}
+			return Ret;
+		};
+
+		const int32 ForwardCount = (LastSegment - FirstSegment + Count) % Count + 1;
+		const int32 BackwardCount = Count - ForwardCount + 2;
+		const double BothArcs = 2. * CalculateSignedArea() + Term(FirstSegment) + Term(LastSegment);
+
+		if (ForwardCount <= BackwardCount)
+		{
+			const double Forward = SumArc(FirstSegment, ForwardCount);
+			return MakeTuple(Forward, BothArcs - Forward);
+		}
+
+		const double Backward = SumArc(LastSegment, BackwardCount);
+		return MakeTuple(BothArcs - Backward, Backward);
+	}
+
+	auto UnionAssumeTwoIntersections(FSegmentArray2D Path) requires bLoop;
+
+	/**
+	 * 영역 안쪽을 지나는 Path로 영역을 잘라서 Path의 끝에서 경계를 따라 정방향으로 Path의 시작까지 돌아오는 쪽만 남깁니다.
+	 */
+	void DifferenceAssumeTwoIntersections(const FSegmentArray2D& Path) requires bLoop;
+
+	/**
+	 * 자르는 Path들이 서로 교차해서 섬들을 한 번에 구할 수 없을 때 사용하는 방법
+	 * 각 Path부터 시작해서 순서대로 자른 섬들을 모두 만들어보고 가장 넓은 섬을 남깁니다.
+	 *
+	 * @param OutDiscardedIslands nullptr가 아니면 가장 넓은 섬을 만들 때 자를 때마다 잘려나간 쪽을 추가함
+	 */
+	bool DifferenceIslandByIsland(const TArray<FSegmentArray2D>& CleanPaths, TArray<TSegmentArray2D<true>>* OutDiscardedIslands) requires bLoop;
+};
+
+
+struct FUnionResult
+{
+	FSegmentArray2D CorrectlyAlignedPath;
+};
+
+
+template <bool bLoop>
+void TSegmentArray2D<bLoop>::ReplacePoints(int32 FirstIndex, int32 LastIndex, TArrayView<const FVector2D> NewPoints) requires bLoop
+{
+	FirstIndex = FirstIndex % FMath::Max(Points.Num(), 1);
+	LastIndex = LastIndex % FMath::Max(Points.Num(), 1);
+
+	if (FirstIndex <= LastIndex)
 	{
 		ReplacePointsNoLoop(FirstIndex, LastIndex, NewPoints);
 		return;
 	}
 
-	ReplacePointsNoLoop(FirstIndex, Points.Num() - 1, NewPoints);
-	ReplacePointsNoLoop(0, LastIndex, {});
+	// 배열의 끝과 처음에 걸친 점들을 교체하면 남는 점들은 [LastIndex + 1, FirstIndex - 1] 뿐이므로
+	// 이 점들을 맨 앞으로 한 번 옮기고 그 뒤에 새 점들을 붙임
+	const int32 KeptCount = FirstIndex - LastIndex - 1;
+	SpliceCachedProperties(FirstIndex, Points.Num() - KeptCount, NewPoints);
+
+	if (Points.IsShared())
+	{
+		TArray<FVector2D> Replaced;
+		Replaced.Reserve(KeptCount + NewPoints.Num());
+		Replaced.Append(Points.GetData() + LastIndex + 1, KeptCount);
+		Replaced.Append(NewPoints.GetData(), NewPoints.Num());
+		Points = MoveTemp(Replaced);
+		InvalidateIndexedCaches();
+		return;
+	}
+
+	TArray<FVector2D>& MutablePoints = Points.Mutable();
+
+	if (KeptCount > 0)
+	{
+		FMemory::Memmove(MutablePoints.GetData(), MutablePoints.GetData() + LastIndex + 1, KeptCount * sizeof(FVector2D));
+	}
+
+	MutablePoints.SetNum(KeptCount, EAllowShrinking::No);
+	MutablePoints.Append(NewPoints.GetData(), NewPoints.Num());
+	InvalidateIndexedCaches();
 }
 
 template <bool bLoop>
@@ -637,27 +1539,85 @@ bool TSegmentArray2D<bLoop>::IsInside(const FVector2D& Point) const requires bLo
 		return false;
 	}
 
-	TArray<double> IntersectingXes;
-	for (const FSegment2D& Each : *this)
+	if (const FSegmentArraySoA* SoA = FindPointsSoA())
+	{
+		return SegmentArrayKernels::IsInside(*SoA, Point);
+	}
+
+	bool bInside = false;
+	const FVector2D* Start = &Points.Last();
+	for (const FVector2D& End : Points)
+	{
+		switch (ClassifyEdgeCrossing(*Start, End, Point))
+		{
+		case EEdgeCrossing::OnEdge:
+			return true;
+		case EEdgeCrossing::Crossing:
+			bInside = !bInside;
+			break;
+		default:
+			break;
+		}
+		Start = &End;
+	}
+
+	return bInside;
+}
+
+template <bool bLoop>
+void TSegmentArray2D<bLoop>::IsInside(TArrayView<const FVector2D> InPoints, TArrayView<bool> OutResults) const requires bLoop
+{
+	check(InPoints.Num() == OutResults.Num());
+
+	for (bool& Each : OutResults)
+	{
+		Each = false;
+	}
+
+	if (!IsValid())
+	{
+		return;
+	}
+
+	// Segment가 많으면 점마다 SIMD로 한 번씩 훑는 게 더 빠름
+	if (const FSegmentArraySoA* SoA = FindPointsSoA())
 	{
-		if (Each.NearlyContainsY(Point.Y))
+		for (int32 i = 0; i < InPoints.Num(); i++)
 		{
-			const double IntersectionX = Each.StartPoint().X + (Point.Y - Each.StartPoint().Y) / Each.Slope();
+			OutResults[i] = SegmentArrayKernels::IsInside(*SoA, InPoints[i]);
+		}
+		return;
+	}
 
-			if (IsNearlyLE(Point.X, IntersectionX))
+	// 경계 위에 있는 것으로 판정된 점은 이후의 변들을 무시해야 하므로 따로 표시함
+	TArray<bool, TInlineAllocator<64>> OnEdge;
+	OnEdge.SetNumZeroed(InPoints.Num());
+
+	const FVector2D* Start = &Points.Last();
+	for (const FVector2D& End : Points)
+	{
+		for (int32 i = 0; i < InPoints.Num(); i++)
+		{
+			if (OnEdge[i])
 			{
-				if (!IntersectingXes.FindByPredicate([&](double X)
-				{
-					return FMath::IsNearlyEqual(X, IntersectionX, UE_KINDA_SMALL_NUMBER);
-				}))
-				{
-					IntersectingXes.Add(IntersectionX);
-				}
+				continue;
+			}
+
+			switch (ClassifyEdgeCrossing(*Start, End, InPoints[i]))
+			{
+			case EEdgeCrossing::OnEdge:
+				OnEdge[i] = true;
+				OutResults[i] = true;
+				break;
+			case EEdgeCrossing::Crossing:
+				OutResults[i] = !OutResults[i];
+				break;
+			default:
+				break;
 			}
 		}
+		Start = &End;
 	}
-
-	return IntersectingXes.Num() % 2 == 1;
 }
 
 template <bool bLoop>
@@ -674,48 +1634,204 @@ bool TSegmentArray2D<bLoop>::IsInside(const TSegmentArray2D& Other) const requir
 }
 
 template <bool bLoop>
-typename TSegmentArray2D<bLoop>::FIntersection
-TSegmentArray2D<bLoop>::FindClosestPointTo(const FVector2D& Point) const
+TOptional<typename TSegmentArray2D<bLoop>::FIntersection>
+TSegmentArray2D<bLoop>::FindClosestPointWithinSquared(const FVector2D& Point, double MaxDistanceSquared) const
 {
-	FIntersection Ret{};
-	float ShortestDistance = TNumericLimits<float>::Max();
+	TOptional<FIntersection> Ret;
+	float ShortestDistanceSquared = TNumericLimits<float>::Max();
+
+	const auto TestSegment = [&](int32 i)
+	{
+		const FRawSegment2D EachSegment = GetRawSegment(i);
+		const double Alpha = EachSegment.ProjectUnitRange(Point);
+		const double DistanceSquared = FVector2D::DistSquared(EachSegment.PointBetween(Alpha), Point);
+		if (DistanceSquared > MaxDistanceSquared)
+		{
+			return;
+		}
+
+		// 인덱스를 사용하면 Segment를 순서대로 방문하지 않으므로 거리가 같으면 인덱스가 작은 쪽을 선택해서 선형 탐색과 결과를 맞춤
+		const float ComparedDistanceSquared = static_cast<float>(DistanceSquared);
+		if (!Ret
+			|| ComparedDistanceSquared < ShortestDistanceSquared
+			|| (ComparedDistanceSquared == ShortestDistanceSquared && i < Ret->SegmentIndex))
+		{
+			ShortestDistanceSquared = ComparedDistanceSquared;
+			Ret = FIntersection{.SegmentIndex = i, .Alpha = static_cast<float>(Alpha)};
+		}
+	};
+
+	if (const FSegmentSpatialIndex2D* Index = FindSpatialIndex())
+	{
+		// 거리를 float로 비교하므로 건너뛸 때도 float로 비교해야 거리가 같은 Segment를 놓치지 않음
+		Index->ForEachNearest(Point, [&](double LowerBoundSquared)
+		{
+			return LowerBoundSquared > MaxDistanceSquared || static_cast<float>(LowerBoundSquared) > ShortestDistanceSquared;
+		}, TestSegment);
+		return Ret;
+	}
+
+	// 가장 가까운 Segment가 반경 밖이면 반경 안에는 아무것도 없으므로 반경과 상관 없이 가장 가까운 후보들만 검사하면 됨
+	if (const FSegmentArraySoA* SoA = FindPointsSoA())
+	{
+		SegmentArrayKernels::ForEachSegmentNear(*SoA, bLoop, Point, TestSegment);
+		return Ret;
+	}
 
 	for (int32 i = 0; i < SegmentCount(); i++)
 	{
-		const FSegment2D& EachSegment = operator[](i);
-		const FSegment2D SegmentToPoint = EachSegment.Perp(Point);
-		const float DistanceToPoint = SegmentToPoint.Length();
+		TestSegment(i);
 
-		if (DistanceToPoint < ShortestDistance)
+		// 점이 Segment 위에 있으면 뒤쪽 Segment는 거리가 같아도 인덱스가 커서 선택될 수 없음
+		if (Ret && ShortestDistanceSquared == 0.f)
 		{
-			ShortestDistance = DistanceToPoint;
-			Ret.SegmentIndex = i;
-			Ret.Alpha = EachSegment.ProjectUnitRange(SegmentToPoint.StartPoint());
+			break;
+		}
+	}
+
+	return Ret;
+}
+
+template <bool bLoop>
+TArray<typename TSegmentArray2D<bLoop>::FIntersection>
+TSegmentArray2D<bLoop>::FindClosestPointsTo(const FVector2D& Point, int32 Count) const
+{
+	struct FCandidate
+	{
+		float DistanceSquared;
+		int32 SegmentIndex;
+		float Alpha;
+	};
+
+	// 먼 후보가 힙의 꼭대기에 오도록 해서 Count개가 찼을 때 가장 먼 후보를 바로 버릴 수 있게 함
+	const auto IsFarther = [](const FCandidate& Left, const FCandidate& Right)
+	{
+		return Left.DistanceSquared != Right.DistanceSquared
+			? Left.DistanceSquared > Right.DistanceSquared
+			: Left.SegmentIndex > Right.SegmentIndex;
+	};
+
+	Count = FMath::Min(Count, FMath::Max(SegmentCount(), 0));
+	if (Count <= 0)
+	{
+		return {};
+	}
+
+	TArray<FCandidate> Heap;
+	Heap.Reserve(Count + 1);
+
+	const auto TestSegment = [&](int32 i)
+	{
+		const FRawSegment2D EachSegment = GetRawSegment(i);
+		const double Alpha = EachSegment.ProjectUnitRange(Point);
+		const FCandidate Candidate{
+			.DistanceSquared = static_cast<float>(FVector2D::DistSquared(EachSegment.PointBetween(Alpha), Point)),
+			.SegmentIndex = i,
+			.Alpha = static_cast<float>(Alpha),
+		};
+
+		const bool bFull = Heap.Num() == Count;
+		if (bFull && !IsFarther(Heap.HeapTop(), Candidate))
+		{
+			return;
+		}
+
+		// 공간 인덱스는 모양이 바뀐 Segment를 Pending 목록과 트리에서 한 번씩 방문하므로 이미 힙에 들어간 Segment는 다시 넣지 않음
+		if (Heap.ContainsByPredicate([&](const FCandidate& Each) { return Each.SegmentIndex == i; }))
+		{
+			return;
+		}
+
+		if (!bFull)
+		{
+			Heap.HeapPush(Candidate, IsFarther);
+		}
+		else
+		{
+			Heap.HeapPopDiscard(IsFarther, EAllowShrinking::No);
+			Heap.HeapPush(Candidate, IsFarther);
+		}
+	};
+
+	if (const FSegmentSpatialIndex2D* Index = FindSpatialIndex())
+	{
+		Index->ForEachNearest(Point, [&](double LowerBoundSquared)
+		{
+			return Heap.Num() == Count && static_cast<float>(LowerBoundSquared) > Heap.HeapTop().DistanceSquared;
+		}, TestSegment);
+	}
+	else
+	{
+		for (int32 i = 0; i < SegmentCount(); i++)
+		{
+			TestSegment(i);
 		}
 	}
 
+	Heap.Sort([&](const FCandidate& Left, const FCandidate& Right) { return IsFarther(Right, Left); });
+
+	TArray<FIntersection> Ret;
+	Ret.Reserve(Heap.Num());
+	for (const FCandidate& Each : Heap)
+	{
+		Ret.Add({.SegmentIndex = Each.SegmentIndex, .Alpha = Each.Alpha});
+	}
 	return Ret;
 }
 
 template <bool bLoop>
 TOptional<typename TSegmentArray2D<bLoop>::FIntersection>
-TSegmentArray2D<bLoop>::FindIntersection(const UE::Geometry::FSegment2d& Segment) const
+TSegmentArray2D<bLoop>::FindIntersection(const FRawSegment2D& Segment) const
 {
 	if (!IsValid())
 	{
 		return {};
 	}
 
-	for (int32 i = 0; i < SegmentCount(); i++)
+	const auto TestSegment = [&](int32 i) -> TOptional<FIntersection>
 	{
-		const FSegment2D& EachSegment = operator[](i);
-		if (TOptional<float> Intersection = EachSegment.Intersects(Segment))
+		if (TOptional<float> Intersection = GetRawSegment(i).Intersects(Segment))
 		{
 			FIntersection Ret;
 			Ret.SegmentIndex = i;
 			Ret.Alpha = *Intersection;
 			return Ret;
 		}
+		return {};
+	};
+
+	if (const FSegmentSpatialIndex2D* Index = FindSpatialIndex())
+	{
+		const FBox2D Bounds = Segment.Bounds();
+		for (int32 Each : GatherCandidateSegments([&](const auto& Add) { Index->ForEachOverlapping(Bounds, Add); }))
+		{
+			if (TOptional<FIntersection> Found = TestSegment(Each))
+			{
+				return Found;
+			}
+		}
+		return {};
+	}
+
+	if (const FSegmentArraySoA* SoA = FindPointsSoA())
+	{
+		TOptional<FIntersection> Ret;
+		SegmentArrayKernels::ForEachSegmentOverlapping(*SoA, bLoop, Segment.Bounds(), [&](int32 Each)
+		{
+			if (!Ret)
+			{
+				Ret = TestSegment(Each);
+			}
+		});
+		return Ret;
+	}
+
+	for (int32 i = 0; i < SegmentCount(); i++)
+	{
+		if (TOptional<FIntersection> Found = TestSegment(i))
+		{
+			return Found;
+		}
 	}
 
 	return {};
@@ -723,7 +1839,7 @@ TSegmentArray2D<bLoop>::FindIntersection(const UE::Geometry::FSegment2d& Segment
 
 template <bool bLoop>
 TArray<typename TSegmentArray2D<bLoop>::FIntersection>
-TSegmentArray2D<bLoop>::FindAllIntersections(const UE::Geometry::FSegment2d& Segment) const
+TSegmentArray2D<bLoop>::FindAllIntersections(const FRawSegment2D& Segment) const
 {
 	if (!IsValid())
 	{
@@ -731,18 +1847,159 @@ TSegmentArray2D<bLoop>::FindAllIntersections(const UE::Geometry::FSegment2d& Seg
 	}
 
 	TArray<FIntersection> Ret;
-	for (int32 i = 0; i < SegmentCount(); i++)
+	const auto TestSegment = [&](int32 i)
 	{
-		const FSegment2D& EachSegment = operator[](i);
-		if (TOptional<float> Intersection = EachSegment.Intersects(Segment))
+		if (TOptional<float> Intersection = GetRawSegment(i).Intersects(Segment))
 		{
 			Ret.Add({
 				.SegmentIndex = i,
 				.Alpha = *Intersection,
 			});
 		}
+	};
+
+	if (const FSegmentSpatialIndex2D* Index = FindSpatialIndex())
+	{
+		const FBox2D Bounds = Segment.Bounds();
+		for (int32 Each : GatherCandidateSegments([&](const auto& Add) { Index->ForEachOverlapping(Bounds, Add); }))
+		{
+			TestSegment(Each);
+		}
+		return Ret;
+	}
+
+	if (const FSegmentArraySoA* SoA = FindPointsSoA())
+	{
+		SegmentArrayKernels::ForEachSegmentOverlapping(*SoA, bLoop, Segment.Bounds(), TestSegment);
+		return Ret;
+	}
+
+	for (int32 i = 0; i < SegmentCount(); i++)
+	{
+		TestSegment(i);
+	}
+
+	return Ret;
+}
+
+template <bool bLoop>
+bool TSegmentArray2D<bLoop>::IsNear(const FRawSegment2D& Segment, double Distance) const
+{
+	const double DistanceSquared = Distance * Distance;
+	const FBox2D SegmentBounds = Segment.Bounds();
+	const FBox2D Bounds{SegmentBounds.Min - FVector2D{Distance, Distance}, SegmentBounds.Max + FVector2D{Distance, Distance}};
+
+	bool bFound = false;
+	const auto TestSegment = [&](int32 i)
+	{
+		bFound = bFound || GetRawSegment(i).SquaredDistanceTo(Segment) <= DistanceSquared;
+	};
+
+	if (const FSegmentSpatialIndex2D* Index = FindSpatialIndex())
+	{
+		Index->ForEachOverlapping(Bounds, TestSegment);
+		return bFound;
+	}
+
+	if (const FSegmentArraySoA* SoA = FindPointsSoA())
+	{
+		SegmentArrayKernels::ForEachSegmentOverlapping(*SoA, bLoop, Bounds, TestSegment);
+		return bFound;
+	}
+
+	for (int32 i = 0; i < SegmentCount() && !bFound; i++)
+	{
+		TestSegment(i);
+	}
+
+	return bFound;
+}
+
+template <bool bLoop>
+template <bool bPathLoop>
+TArray<typename TSegmentArray2D<bLoop>::FPathIntersection>
+TSegmentArray2D<bLoop>::FindAllIntersectionsAlong(const TSegmentArray2D<bPathLoop>& Path) const
+{
+	if (!IsValid() || !Path.IsValid())
+	{
+		return {};
+	}
+
+	TArray<FPathIntersection> Ret;
+	const auto TestPair = [&](int32 SegmentIndex, int32 PathSegmentIndex, const FRawSegment2D& PathSegment)
+	{
+		if (TOptional<float> Intersection = GetRawSegment(SegmentIndex).Intersects(PathSegment))
+		{
+			const FIntersection Found{.SegmentIndex = SegmentIndex, .Alpha = *Intersection};
+			const FVector2D Point = Found.Location(*this);
+			Ret.Add({
+				.PathSegmentIndex = PathSegmentIndex,
+				.DistanceAlongPathSegment = (Point - PathSegment.Start).Length(),
+				.Intersection = Found,
+				.Point = Point,
+			});
+		}
+	};
+
+	TArray<FRawSegment2D> PathSegments;
+	PathSegments.Reserve(Path.SegmentCount());
+	for (const FRawSegment2D& Each : Path.RawSegments())
+	{
+		PathSegments.Add(Each);
 	}
 
+	// Path가 짧으면 경계 전체를 정렬하는 것보다 이미 만들어둔 인덱스에 Segment마다 물어보는 쪽이 빠름
+	const FSegmentSpatialIndex2D* Index = FindSpatialIndex();
+	if (Index && PathSegments.Num() * FMath::CeilLogTwo(static_cast<uint32>(SegmentCount())) < static_cast<uint32>(SegmentCount()))
+	{
+		for (int32 i = 0; i < PathSegments.Num(); i++)
+		{
+			const FBox2D Bounds = PathSegments[i].Bounds();
+			for (int32 Each : GatherCandidateSegments([&](const auto& Add) { Index->ForEachOverlapping(Bounds, Add); }))
+			{
+				TestPair(Each, i, PathSegments[i]);
+			}
+		}
+	}
+	else
+	{
+		TArray<FBox2D> SegmentBounds;
+		SegmentBounds.Reserve(SegmentCount());
+		for (int32 i = 0; i < SegmentCount(); i++)
+		{
+			SegmentBounds.Add(FSegmentSpatialIndex2D::MakeSegmentBounds(
+				Points[SegmentIndexToStartPointIndex(i)], Points[SegmentIndexToEndPointIndex(i)]));
+		}
+
+		TArray<FBox2D> PathSegmentBounds;
+		PathSegmentBounds.Reserve(PathSegments.Num());
+		for (const FRawSegment2D& Each : PathSegments)
+		{
+			PathSegmentBounds.Add(Each.Bounds());
+		}
+
+		SegmentSweep::ForEachOverlappingPair(SegmentBounds, PathSegmentBounds, [&](int32 SegmentIndex, int32 PathSegmentIndex)
+		{
+			TestPair(SegmentIndex, PathSegmentIndex, PathSegments[PathSegmentIndex]);
+		});
+	}
+
+	// 정렬 키는 교차지점을 찾을 때 미리 계산해둠
+	Ret.Sort([](const FPathIntersection& Left, const FPathIntersection& Right)
+	{
+		if (Left.PathSegmentIndex != Right.PathSegmentIndex)
+		{
+			return Left.PathSegmentIndex < Right.PathSegmentIndex;
+		}
+
+		if (Left.DistanceAlongPathSegment != Right.DistanceAlongPathSegment)
+		{
+			return Left.DistanceAlongPathSegment < Right.DistanceAlongPathSegment;
+		}
+
+		return Left.Intersection.SegmentIndex < Right.Intersection.SegmentIndex;
+	});
+
 	return Ret;
 }
 
@@ -753,9 +2010,10 @@ TOptional<FVector2D> TSegmentArray2D<bLoop>::Attach(const FVector2D& Point, cons
 
 	double Distance = TNumericLimits<double>::Max();
 	TOptional<FVector2D> Ret;
-	for (FSegment2D Each : *this)
+	const auto TestSegment = [&](int32 i)
 	{
-		if (TOptional<std::tuple<double, double>> Hit = Ray.RayTrace(Each))
+		const FRawSegment2D Each = GetRawSegment(i);
+		if (TOptional<std::tuple<double, double>> Hit = Ray.RayTrace(Each.Start, Each.End))
 		{
 			if (std::get<0>(*Hit) < Distance)
 			{
@@ -763,6 +2021,20 @@ TOptional<FVector2D> TSegmentArray2D<bLoop>::Attach(const FVector2D& Point, cons
 				Ret = Each.PointBetween(std::get<1>(*Hit));
 			}
 		}
+	};
+
+	if (const FSegmentSpatialIndex2D* Index = FindSpatialIndex())
+	{
+		for (int32 Each : GatherCandidateSegments([&](const auto& Add) { Index->ForEachAlongRay(Point, Direction, Add); }))
+		{
+			TestSegment(Each);
+		}
+		return Ret;
+	}
+
+	for (int32 i = 0; i < SegmentCount(); i++)
+	{
+		TestSegment(i);
 	}
 	return Ret;
 }
@@ -814,73 +2086,346 @@ auto TSegmentArray2D<bLoop>::Union(SegmentArrayType&& Path) requires bLoop
 
 template <bool bLoop>
 template <CSegmentArray2D SegmentArrayType>
-bool TSegmentArray2D<bLoop>::Difference(SegmentArrayType&& Path) requires bLoop
+bool TSegmentArray2D<bLoop>::Difference(SegmentArrayType&& Path, TArray<TSegmentArray2D<true>>* OutDiscardedIslands) requires bLoop
 {
 	TArray<FSegmentArray2D> CleanPaths = SplitIntoCleanPaths(Forward<SegmentArrayType>(Path));
 
-	TArray<FLoopedSegmentArray2D> Islands;
+	// 영역 안쪽을 지나는 Clean Path (이하 Cut)만 영역을 자름
+	struct FCut
+	{
+		int32 CleanPathIndex;
+		double PathTerms = 0.;
+		int32 KeptRegion = INDEX_NONE;
+		int32 CutRegion = INDEX_NONE;
+	};
+
+	// Cut이 경계와 만나는 지점
+	struct FCutEnd
+	{
+		int32 CutIndex;
+		bool bPathStart;
+		FIntersection Boundary;
+		FVector2D Point;
+	};
+
+	TArray<FCut> Cuts;
+	TArray<int32> CleanPathToCut;
+	TArray<FCutEnd> CutEnds;
 	for (int32 i = 0; i < CleanPaths.Num(); i++)
 	{
-		Islands.Add(*this);
+		const FSegmentArray2D& CleanPath = CleanPaths[i];
+		if (!IsInside(CleanPath.GetRawSegment(0).Center()))
+		{
+			CleanPathToCut.Add(INDEX_NONE);
+			continue;
+		}
+
+		const int32 CutIndex = Cuts.Add({.CleanPathIndex = i});
+		CleanPathToCut.Add(CutIndex);
+		for (int32 j = 0; j < CleanPath.SegmentCount(); j++)
+		{
+			Cuts[CutIndex].PathTerms += FVector2D::CrossProduct(CleanPath.GetPoint(j), CleanPath.GetPoint(j + 1));
+		}
+
+		CutEnds.Add({CutIndex, true, FindClosestPointTo(CleanPath.GetPoint(0)), CleanPath.GetPoint(0)});
+		CutEnds.Add({CutIndex, false, FindClosestPointTo(CleanPath.GetPoint(-1)), CleanPath.GetPoint(-1)});
+	}
+
+	if (Cuts.IsEmpty())
+	{
+		return false;
 	}
 
-	for (int32 i = 0; i < Islands.Num(); ++i)
+	// 경계를 따라 정방향으로 정렬
+	CutEnds.StableSort([](const FCutEnd& Left, const FCutEnd& Right)
+	{
+		if (Left.Boundary.SegmentIndex == Right.Boundary.SegmentIndex)
+		{
+			return Left.Boundary.Alpha < Right.Boundary.Alpha;
+		}
+		return Left.Boundary.SegmentIndex < Right.Boundary.SegmentIndex;
+	});
+
+	// Cut들이 서로 교차하지 않으면 경계를 따라 만나는 Cut의 양 끝이 괄호처럼 짝이 맞음
+	// 짝이 맞지 않으면 아래의 섬 구하기가 성립하지 않으므로 섬을 하나씩 만들어보는 방법을 사용함
+	TArray<int32, TInlineAllocator<16>> OpenCuts;
+	TArray<int32, TInlineAllocator<32>> OtherEnd;
+	OtherEnd.Init(INDEX_NONE, CutEnds.Num());
+	for (int32 i = 0; i < CutEnds.Num(); i++)
 	{
-		for (int32 j = 0; j < CleanPaths.Num(); ++j)
+		if (!OpenCuts.IsEmpty() && CutEnds[OpenCuts.Last()].CutIndex == CutEnds[i].CutIndex)
+		{
+			OtherEnd[i] = OpenCuts.Pop();
+			OtherEnd[OtherEnd[i]] = i;
+		}
+		else
 		{
-			Islands[i].DifferenceAssumeTwoIntersections(CleanPaths[(i + j) % CleanPaths.Num()]);
+			OpenCuts.Add(i);
 		}
 	}
 
-	if (FLoopedSegmentArray2D* LargestArea = Algo::MaxElementBy(Islands, &FLoopedSegmentArray2D::CalculateArea))
+	if (!OpenCuts.IsEmpty())
+	{
+		return DifferenceIslandByIsland(CleanPaths, OutDiscardedIslands);
+	}
+
+	// 경계 전체를 한 번만 훑어서 Shoelace 항들의 누적합을 구해두면 어떤 호의 항들의 합이든 O(1)에 구할 수 있음
+	const int32 Count = Points.Num();
+	TArray<double> ShoelacePrefixSums;
+	ShoelacePrefixSums.SetNumUninitialized(Count + 1);
+	ShoelacePrefixSums[0] = 0.;
+	for (int32 i = 0; i < Count; i++)
 	{
-		if (LargestArea->CalculateArea() < CalculateArea())
+		ShoelacePrefixSums[i + 1] = ShoelacePrefixSums[i] + FVector2D::CrossProduct(Points[i], Points[(i + 1) % Count]);
+	}
+
+	const auto SumShoelaceTerms = [&](int32 FirstSegment, int32 TermCount)
+	{
+		FirstSegment %= Count;
+		const int32 LastSegment = FirstSegment + TermCount;
+		return LastSegment <= Count
+			? ShoelacePrefixSums[LastSegment] - ShoelacePrefixSums[FirstSegment]
+			: ShoelacePrefixSums[Count] - ShoelacePrefixSums[FirstSegment] + ShoelacePrefixSums[LastSegment - Count];
+	};
+
+	// i번째 Cut 끝에서 다음 Cut 끝까지 경계를 따라가는 호 위의 점 개수
+	const auto ArcPointCount = [&](int32 CutEndIndex)
+	{
+		const int32 From = CutEnds[CutEndIndex].Boundary.SegmentIndex;
+		const int32 To = CutEnds[(CutEndIndex + 1) % CutEnds.Num()].Boundary.SegmentIndex;
+		if (CutEndIndex < CutEnds.Num() - 1)
 		{
-			Points = MoveTemp(LargestArea->Points);
-			return true;
+			return To - From;
+		}
+
+		const int32 Ret = (To - From + Count) % Count;
+		return Ret == 0 ? Count : Ret;
+	};
+
+	// 경계의 호와 Cut을 번갈아 따라가며 한 바퀴 돌면 섬 하나가 됨
+	// 모든 호는 정확히 한 섬에 속하고 모든 Cut은 양쪽 섬에서 한 번씩 (한 번은 정방향, 한 번은 역방향) 지나감
+	struct FRegion
+	{
+		TArray<int32, TInlineAllocator<8>> ArcStarts;
+		float Area;
+	};
+
+	TArray<FRegion> Regions;
+	TArray<bool, TInlineAllocator<32>> bArcVisited;
+	bArcVisited.Init(false, CutEnds.Num());
+	for (int32 i = 0; i < CutEnds.Num(); i++)
+	{
+		if (bArcVisited[i])
+		{
+			continue;
+		}
+
+		const int32 RegionIndex = Regions.AddDefaulted();
+		double DoubleArea = 0.;
+		for (int32 Arc = i; !bArcVisited[Arc];)
+		{
+			bArcVisited[Arc] = true;
+			Regions[RegionIndex].ArcStarts.Add(Arc);
+
+			const int32 ArcEnd = (Arc + 1) % CutEnds.Num();
+			const FCutEnd& From = CutEnds[Arc];
+			const FCutEnd& To = CutEnds[ArcEnd];
+
+			if (const int32 ArcPoints = ArcPointCount(Arc); ArcPoints == 0)
+			{
+				DoubleArea += FVector2D::CrossProduct(From.Point, To.Point);
+			}
+			else
+			{
+				DoubleArea += FVector2D::CrossProduct(From.Point, Points[(From.Boundary.SegmentIndex + 1) % Count])
+					+ SumShoelaceTerms(From.Boundary.SegmentIndex + 1, ArcPoints - 1)
+					+ FVector2D::CrossProduct(Points[To.Boundary.SegmentIndex], To.Point);
+			}
+
+			FCut& Cut = Cuts[To.CutIndex];
+			DoubleArea += To.bPathStart ? Cut.PathTerms : -Cut.PathTerms;
+			(To.bPathStart ? Cut.KeptRegion : Cut.CutRegion) = RegionIndex;
+
+			Arc = OtherEnd[ArcEnd];
+		}
+
+		Regions[RegionIndex].Area = static_cast<float>(0.5 * FMath::Abs(DoubleArea));
+	}
+
+	// 섬들은 Cut을 간선으로 하는 트리를 이루므로 Cut을 하나 적용하면 Cut 건너편의 섬들이 모두 떨어져나감
+	// Start번째 Clean Path부터 순서대로 자르면서 아직 남아있는 영역 안쪽을 지나는 Cut만 적용했을 때 최종적으로 남는 섬을 반환
+	const auto FindSurvivingRegion = [&](int32 StartCleanPath, TArray<int32>* OutAppliedCleanPaths)
+	{
+		TArray<bool, TInlineAllocator<16>> bAlive;
+		bAlive.Init(true, Regions.Num());
+
+		for (int32 i = 0; i < CleanPaths.Num(); i++)
+		{
+			const int32 CleanPathIndex = (StartCleanPath + i) % CleanPaths.Num();
+			const int32 CutIndex = CleanPathToCut[CleanPathIndex];
+			if (CutIndex == INDEX_NONE || !bAlive[Cuts[CutIndex].KeptRegion] || !bAlive[Cuts[CutIndex].CutRegion])
+			{
+				continue;
+			}
+
+			if (OutAppliedCleanPaths)
+			{
+				OutAppliedCleanPaths->Add(CleanPathIndex);
+			}
+
+			TArray<int32, TInlineAllocator<16>> Stack{Cuts[CutIndex].CutRegion};
+			bAlive[Cuts[CutIndex].CutRegion] = false;
+			while (!Stack.IsEmpty())
+			{
+				const int32 Region = Stack.Pop();
+				for (int32 j = 0; j < Cuts.Num(); j++)
+				{
+					const FCut& Each = Cuts[j];
+					const int32 Neighbor = Each.KeptRegion == Region ? Each.CutRegion : Each.CutRegion == Region ? Each.KeptRegion : INDEX_NONE;
+					if (j != CutIndex && Neighbor != INDEX_NONE && bAlive[Neighbor])
+					{
+						bAlive[Neighbor] = false;
+						Stack.Add(Neighbor);
+					}
+				}
+			}
+		}
+
+		return bAlive.Find(true);
+	};
+
+	// 섬이 같은 넓이면 먼저 시작한 쪽을 선택
+	int32 LargestStart = INDEX_NONE;
+	int32 LargestRegion = INDEX_NONE;
+	for (int32 i = 0; i < CleanPaths.Num(); i++)
+	{
+		const int32 Region = FindSurvivingRegion(i, nullptr);
+		if (LargestRegion == INDEX_NONE || Regions[LargestRegion].Area < Regions[Region].Area)
+		{
+			LargestStart = i;
+			LargestRegion = Region;
+		}
+	}
+
+	if (!(Regions[LargestRegion].Area < CalculateArea()))
+	{
+		return false;
+	}
+
+	if (OutDiscardedIslands)
+	{
+		for (int32 i = 0; i < Regions.Num(); i++)
+		{
+			if (i == LargestRegion)
+			{
+				continue;
+			}
+
+			TArray<FVector2D> IslandPoints;
+			for (int32 Arc : Regions[i].ArcStarts)
+			{
+				const int32 FirstSegment = CutEnds[Arc].Boundary.SegmentIndex;
+				for (int32 j = 0, ArcPoints = ArcPointCount(Arc); j < ArcPoints; j++)
+				{
+					IslandPoints.Add(Points[(FirstSegment + 1 + j) % Count]);
+				}
+
+				const FCutEnd& To = CutEnds[(Arc + 1) % CutEnds.Num()];
+				const TArray<FVector2D>& CutPoints = CleanPaths[Cuts[To.CutIndex].CleanPathIndex].GetPoints();
+				if (To.bPathStart)
+				{
+					IslandPoints.Append(CutPoints);
+				}
+				else
+				{
+					for (int32 j = CutPoints.Num() - 1; j >= 0; j--)
+					{
+						IslandPoints.Add(CutPoints[j]);
+					}
+				}
+			}
+
+			OutDiscardedIslands->Emplace(MoveTemp(IslandPoints));
 		}
 	}
 
-	return false;
+	// 가장 넓은 섬을 남기는 Cut들만 같은 순서로 적용함
+	TArray<int32> AppliedCleanPaths;
+	FindSurvivingRegion(LargestStart, &AppliedCleanPaths);
+	for (int32 Each : AppliedCleanPaths)
+	{
+		DifferenceAssumeTwoIntersections(CleanPaths[Each]);
+	}
+
+	return true;
 }
 
 
 template <bool bLoop>
-TArray<FSegmentArray2D> TSegmentArray2D<bLoop>::SplitIntoCleanPaths(FSegmentArray2D Path)
+bool TSegmentArray2D<bLoop>::DifferenceIslandByIsland(const TArray<FSegmentArray2D>& CleanPaths, TArray<TSegmentArray2D<true>>* OutDiscardedIslands) requires bLoop
 {
-	struct FPathIntersection
+	// Start번째 Clean Path부터 순서대로 잘라서 남는 섬을 반환, OutCutPieces가 nullptr가 아니면 자를 때마다 잘려나간 쪽을 추가함
+	const auto MakeIsland = [&](int32 Start, TArray<FLoopedSegmentArray2D>* OutCutPieces)
 	{
-		int32 PathSegmentIndex;
-		FVector2D Point;
-	};
+		FLoopedSegmentArray2D Ret = *this;
+		for (int32 i = 0; i < CleanPaths.Num(); ++i)
+		{
+			const FSegmentArray2D& CleanPath = CleanPaths[(Start + i) % CleanPaths.Num()];
+			if (!Ret.IsInside(CleanPath.GetRawSegment(0).Center()))
+			{
+				continue;
+			}
 
-	// Segment의 양 지점이 Boundary 위에 정확하게 걸쳐져 있는 경우 Intersection Test에 실패할 수 있기 때문에 조금 늘려줌
-	Path.SetPoint(0, Path.GetPoint(0) - Path[0].Direction * UE_KINDA_SMALL_NUMBER);
-	Path.SetPoint(-1, Path.GetPoint(-1) + Path.GetSegmentDirection(-1) * UE_KINDA_SMALL_NUMBER);
+			if (OutCutPieces)
+			{
+				// 반대 방향의 Path로 자르면 남는 쪽과 잘려나가는 쪽이 뒤바뀜
+				FSegmentArray2D ReversedPath = CleanPath;
+				ReversedPath.ReverseVertexOrder();
+				OutCutPieces->Add(Ret);
+				OutCutPieces->Last().DifferenceAssumeTwoIntersections(ReversedPath);
+			}
 
-	TArray<FPathIntersection> AllIntersections;
-	for (int32 i = 0; i < Path.SegmentCount(); i++)
+			Ret.DifferenceAssumeTwoIntersections(CleanPath);
+		}
+		return Ret;
+	};
+
+	// 섬이 같은 넓이면 먼저 시작한 쪽을 선택
+	int32 LargestStart = INDEX_NONE;
+	TOptional<FLoopedSegmentArray2D> LargestIsland;
+	for (int32 i = 0; i < CleanPaths.Num(); ++i)
 	{
-		for (const FIntersection& Each : FindAllIntersections(Path[i]))
+		FLoopedSegmentArray2D Island = MakeIsland(i, nullptr);
+		if (!LargestIsland || LargestIsland->CalculateArea() < Island.CalculateArea())
 		{
-			AllIntersections.Add({
-				.PathSegmentIndex = i,
-				.Point = Each.Location(*this),
-			});
+			LargestStart = i;
+			LargestIsland = MoveTemp(Island);
 		}
 	}
 
-	AllIntersections.Sort([&](const FPathIntersection& Left, const FPathIntersection& Right)
+	if (!LargestIsland || !(LargestIsland->CalculateArea() < CalculateArea()))
 	{
-		if (Left.PathSegmentIndex == Right.PathSegmentIndex)
-		{
-			const FVector2D SegmentStart = Path[Left.PathSegmentIndex].StartPoint();
-			return (Left.Point - SegmentStart).Length() < (Right.Point - SegmentStart).Length();
-		}
+		return false;
+	}
 
-		return Left.PathSegmentIndex < Right.PathSegmentIndex;
-	});
+	if (OutDiscardedIslands)
+	{
+		MakeIsland(LargestStart, OutDiscardedIslands);
+	}
+
+	*this = MoveTemp(*LargestIsland);
+	return true;
+}
+
+
+template <bool bLoop>
+TArray<FSegmentArray2D> TSegmentArray2D<bLoop>::SplitIntoCleanPaths(FSegmentArray2D Path)
+{
+	// Segment의 양 지점이 Boundary 위에 정확하게 걸쳐져 있는 경우 Intersection Test에 실패할 수 있기 때문에 조금 늘려줌
+	Path.SetPoint(0, Path.GetPoint(0) - Path[0].Direction * UE_KINDA_SMALL_NUMBER);
+	Path.SetPoint(-1, Path.GetPoint(-1) + Path.GetSegmentDirection(-1) * UE_KINDA_SMALL_NUMBER);
 
+	const TArray<FPathIntersection> AllIntersections = FindAllIntersectionsAlong(Path);
 	if (AllIntersections.Num() < 2)
 	{
 		return {};
@@ -904,30 +2449,40 @@ TArray<FSegmentArray2D> TSegmentArray2D<bLoop>::SplitIntoCleanPaths(FSegmentArra
 template <bool bLoop>
 auto TSegmentArray2D<bLoop>::UnionAssumeTwoIntersections(FSegmentArray2D Path) requires bLoop
 {
-	if (IsInside(Path[0].Center))
+	if (IsInside(Path.GetRawSegment(0).Center()))
 	{
 		return TOptional<FUnionResult>{};
 	}
 
-	const FIntersection BoundarySrcSegment = FindClosestPointTo(Path.GetPoint(0));
-	const FIntersection BoundaryDestSegment = FindClosestPointTo(Path.GetPoint(-1));
+	const int32 SrcSegmentIndex = FindClosestPointTo(Path.GetPoint(0)).SegmentIndex;
+	const int32 DestSegmentIndex = FindClosestPointTo(Path.GetPoint(-1)).SegmentIndex;
 
-	FLoopedSegmentArray2D SrcToDestReplaced = *this;
-	SrcToDestReplaced.ReplacePointsBySegmentIndices(
-		BoundarySrcSegment.SegmentIndex,
-		BoundaryDestSegment.SegmentIndex,
-		Path.GetPoints());
+	// Path를 그대로 Src에서 Dest로 끼워넣는 경우와 뒤집어서 Dest에서 Src로 끼워넣는 경우 중에 넓이가 더 넓어지는 쪽을 선택해야 함
+	// 영역을 복사해서 실제로 끼워넣어 보는 대신 제거될 호와 끼워넣을 Path의 Shoelace 항들만으로 각 경우의 넓이를 계산함
+	const FVector2D PathStart = Path.GetPoint(0);
+	const FVector2D PathEnd = Path.GetPoint(-1);
 
-	FSegmentArray2D ReversedPath = Path;
-	ReversedPath.ReverseVertexOrder();
-	FLoopedSegmentArray2D DestToSrcReplaced = *this;
-	DestToSrcReplaced.ReplacePointsBySegmentIndices(
-		BoundaryDestSegment.SegmentIndex,
-		BoundarySrcSegment.SegmentIndex,
-		ReversedPath.GetPoints());
+	double PathTerms = 0.;
+	for (int32 i = 0; i < Path.SegmentCount(); i++)
+	{
+		PathTerms += FVector2D::CrossProduct(Path.GetPoint(i), Path.GetPoint(i + 1));
+	}
 
-	const float Area0 = SrcToDestReplaced.CalculateArea();
-	const float Area1 = DestToSrcReplaced.CalculateArea();
+	const auto [SrcToDestArcTerms, DestToSrcArcTerms] = SumShoelaceTermsOfArcs(SrcSegmentIndex, DestSegmentIndex);
+	const double CurrentDoubleArea = 2. * CalculateSignedArea();
+
+	const double SrcToDestDoubleArea = CurrentDoubleArea - SrcToDestArcTerms
+		+ FVector2D::CrossProduct(GetPoint(SegmentIndexToStartPointIndex(SrcSegmentIndex)), PathStart)
+		+ PathTerms
+		+ FVector2D::CrossProduct(PathEnd, GetPoint(SegmentIndexToEndPointIndex(DestSegmentIndex)));
+
+	const double DestToSrcDoubleArea = CurrentDoubleArea - DestToSrcArcTerms
+		+ FVector2D::CrossProduct(GetPoint(SegmentIndexToStartPointIndex(DestSegmentIndex)), PathEnd)
+		- PathTerms
+		+ FVector2D::CrossProduct(PathStart, GetPoint(SegmentIndexToEndPointIndex(SrcSegmentIndex)));
+
+	const float Area0 = static_cast<float>(0.5 * FMath::Abs(SrcToDestDoubleArea));
+	const float Area1 = static_cast<float>(0.5 * FMath::Abs(DestToSrcDoubleArea));
 	const float CurrentArea = CalculateArea();
 
 	// 모종의 이유로 맨 위의 조기 리턴 체크에서 걸러지지 않는 경우가 있음
@@ -937,29 +2492,246 @@ auto TSegmentArray2D<bLoop>::UnionAssumeTwoIntersections(FSegmentArray2D Path) r
 		return TOptional<FUnionResult>{};
 	}
 
-	FSegmentArray2D& UsedPath = Area0 < Area1 ? ReversedPath : Path;
-	Points = Area0 < Area1 ? MoveTemp(DestToSrcReplaced.Points) : MoveTemp(SrcToDestReplaced.Points);
+	if (Area0 < Area1)
+	{
+		Path.ReverseVertexOrder();
+		ReplacePointsBySegmentIndices(DestSegmentIndex, SrcSegmentIndex, Path.GetPoints());
+	}
+	else
+	{
+		ReplacePointsBySegmentIndices(SrcSegmentIndex, DestSegmentIndex, Path.GetPoints());
+	}
 
-	return TOptional<FUnionResult>{{.CorrectlyAlignedPath = MoveTemp(UsedPath)}};
+	return TOptional<FUnionResult>{{.CorrectlyAlignedPath = MoveTemp(Path)}};
 }
 
 
 template <bool bLoop>
-void TSegmentArray2D<bLoop>::DifferenceAssumeTwoIntersections(FSegmentArray2D Path) requires bLoop
+void TSegmentArray2D<bLoop>::DifferenceAssumeTwoIntersections(const FSegmentArray2D& Path) requires bLoop
 {
-	if (!IsInside(Path[0].Center))
+	const FIntersection BoundarySrcSegment = FindClosestPointTo(Path.GetPoint(0));
+	const FIntersection BoundaryDestSegment = FindClosestPointTo(Path.GetPoint(-1));
+
+	// 같은 Segment로 들어왔다가 들어온 지점보다 뒤에서 나가면 남는 쪽은 Path와 그 Segment의 일부로만 둘러싸임
+	if (BoundarySrcSegment.SegmentIndex == BoundaryDestSegment.SegmentIndex && BoundaryDestSegment.Alpha < BoundarySrcSegment.Alpha)
 	{
+		ReplacePointsNoLoop(0, PointCount() - 1, Path.GetPoints());
 		return;
 	}
 
-	const FIntersection BoundarySrcSegment = FindClosestPointTo(Path.GetPoint(0));
-	const FIntersection BoundaryDestSegment = FindClosestPointTo(Path.GetPoint(-1));
-
-	FLoopedSegmentArray2D SrcToDestReplaced = *this;
-	SrcToDestReplaced.ReplacePointsBySegmentIndices(
+	ReplacePointsBySegmentIndices(
 		BoundarySrcSegment.SegmentIndex,
 		BoundaryDestSegment.SegmentIndex,
 		Path.GetPoints());
+}
+
+template <bool bLoop>
+int32 TSegmentArray2D<bLoop>::Simplify(float MaxError, int32 MaxPointCount) requires bLoop
+{
+	const int32 Count = Points.Num();
+	if (Count <= 3)
+	{
+		return 0;
+	}
+
+	// 점을 실제로 지우지 않고 연결 리스트로 이어두었다가 마지막에 한 번에 배열을 다시 만듦
+	TArray<int32> Prev;
+	TArray<int32> Next;
+	Prev.SetNumUninitialized(Count);
+	Next.SetNumUninitialized(Count);
+	for (int32 i = 0; i < Count; i++)
+	{
+		Prev[i] = (i - 1 + Count) % Count;
+		Next[i] = (i + 1) % Count;
+	}
+
+	// i번째 점에서 다음 점까지의 Segment가 대신하고 있는 (이미 제거된) 점들이 그 Segment에서 떨어진 거리의 상한
+	// 제거된 점들을 모두 기억했다가 다시 훑는 대신 Segment를 합칠 때마다 상한만 갱신해서 점 하나를 제거하는 비용을 일정하게 유지함
+	TArray<double> SpanErrors;
+	SpanErrors.SetNumZeroed(Count);
+
+	const auto SquaredDistanceToSegment = [](const FVector2D& Point, const FVector2D& Start, const FVector2D& End)
+	{
+		const FVector2D Direction = End - Start;
+		const double LengthSquared = Direction.SquaredLength();
+		const double T = LengthSquared > 0. ? FMath::Clamp((Point - Start).Dot(Direction) / LengthSquared, 0., 1.) : 0.;
+		return FVector2D::DistSquared(Point, Start + Direction * T);
+	};
+
+	// 제거된 점은 예전 Segment에서 SpanError 이내에 있고 예전 Segment 위의 점은 새 Segment에서 Index까지의 거리 이내에 있으므로
+	// 두 거리의 합이 Index를 제거했을 때 제거된 점들이 새 Segment에서 떨어지는 거리의 상한이 됨
+	const auto CalculateError = [&](int32 Index)
+	{
+		const double Distance = FMath::Sqrt(SquaredDistanceToSegment(Points[Index], Points[Prev[Index]], Points[Next[Index]]));
+		return Distance + FMath::Max(SpanErrors[Prev[Index]], SpanErrors[Index]);
+	};
+
+	// 남아있는 점들을 격자에 넣어두고 삼각형과 겹치는 칸에 있는 점들만 검사함
+	const FBox2D Bounds = CalculateBoundingBox();
+	const int32 GridSize = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(Count / 4.)));
+	const FVector2D CellSize = FVector2D::Max(Bounds.GetSize() / GridSize, FVector2D{UE_KINDA_SMALL_NUMBER, UE_KINDA_SMALL_NUMBER});
+	const auto CellCoordinate = [&](const FVector2D& Point)
+	{
+		const FVector2D Cell = (Point - Bounds.Min) / CellSize;
+		return FIntPoint{
+			FMath::Clamp(FMath::FloorToInt(Cell.X), 0, GridSize - 1),
+			FMath::Clamp(FMath::FloorToInt(Cell.Y), 0, GridSize - 1)
+		};
+	};
+
+	TArray<TArray<int32, TInlineAllocator<4>>> Grid;
+	Grid.SetNum(GridSize * GridSize);
+	for (int32 i = 0; i < Count; i++)
+	{
+		const FIntPoint Cell = CellCoordinate(Points[i]);
+		Grid[Cell.Y * GridSize + Cell.X].Add(i);
+	}
+
+	// Index를 지웠을 때 새로 이어지는 Segment가 다른 Segment와 교차하지 않는지 검사해서 교차하게 만드는 점을 반환함
+	// 지금 경계가 스스로 교차하지 않으므로 제거될 두 Segment와 새 Segment가 이루는 삼각형 안에 다른 점이 없으면 됨
+	const auto FindBlockingPoint = [&](int32 Index) -> int32
+	{
+		const FVector2D& A = Points[Prev[Index]];
+		const FVector2D& B = Points[Index];
+		const FVector2D& C = Points[Next[Index]];
+
+		FBox2D Triangle{ForceInit};
+		Triangle += A;
+		Triangle += B;
+		Triangle += C;
+
+		const FIntPoint MinCell = CellCoordinate(Triangle.Min);
+		const FIntPoint MaxCell = CellCoordinate(Triangle.Max);
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+		{
+			for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+			{
+				for (int32 Each : Grid[Y * GridSize + X])
+				{
+					if (Each == Prev[Index] || Each == Index || Each == Next[Index])
+					{
+						continue;
+					}
+
+					// 삼각형의 변 위에 있는 점도 교차로 봄 (일직선인 삼각형은 직선 위의 모든 점이 변 위로 판정되므로 AABB로 먼저 거름)
+					const FVector2D& P = Points[Each];
+					if (!Triangle.IsInsideOrOn(P))
+					{
+						continue;
+					}
+
+					const double D0 = FVector2D::CrossProduct(B - A, P - A);
+					const double D1 = FVector2D::CrossProduct(C - B, P - B);
+					const double D2 = FVector2D::CrossProduct(A - C, P - C);
+					if ((D0 >= 0. && D1 >= 0. && D2 >= 0.) || (D0 <= 0. && D1 <= 0. && D2 <= 0.))
+					{
+						return Each;
+					}
+				}
+			}
+		}
+
+		return INDEX_NONE;
+	};
+
+	struct FCandidate
+	{
+		double Error;
+		int32 Index;
+		int32 Version;
+
+		bool operator<(const FCandidate& Other) const
+		{
+			return Error < Other.Error || (Error == Other.Error && Index < Other.Index);
+		}
+	};
+
+	// 이웃이 바뀌어서 오차를 다시 계산하면 Version을 올려서 힙에 남아있는 예전 후보를 무시함
+	TArray<int32> Versions;
+	Versions.SetNumZeroed(Count);
+
+	// i번째 점이 삼각형 안에 있어서 제거하지 못한 점들, i번째 점이 제거되면 다시 후보가 됨
+	TArray<TArray<int32, TInlineAllocator<2>>> BlockedBy;
+	BlockedBy.SetNum(Count);
+
+	TArray<FCandidate> Candidates;
+	Candidates.Reserve(Count);
+	for (int32 i = 0; i < Count; i++)
+	{
+		Candidates.Add({CalculateError(i), i, 0});
+	}
+	Candidates.Heapify();
+
+	int32 RemainingCount = Count;
+	while (RemainingCount > 3 && !Candidates.IsEmpty())
+	{
+		FCandidate Candidate;
+		Candidates.HeapPop(Candidate, EAllowShrinking::No);
+
+		if (Candidate.Version != Versions[Candidate.Index])
+		{
+			continue;
+		}
+
+		if (Candidate.Error > MaxError && (MaxPointCount <= 0 || RemainingCount <= MaxPointCount))
+		{
+			break;
+		}
+
+		// 이웃이 제거되거나 삼각형 안에 있는 점이 제거되면 다시 후보가 됨
+		const int32 BlockingPoint = FindBlockingPoint(Candidate.Index);
+		if (BlockingPoint != INDEX_NONE)
+		{
+			BlockedBy[BlockingPoint].Add(Candidate.Index);
+			continue;
+		}
+
+		const int32 Removed = Candidate.Index;
+		const int32 Before = Prev[Removed];
+		const int32 After = Next[Removed];
+
+		SpanErrors[Before] = Candidate.Error;
+
+		Next[Before] = After;
+		Prev[After] = Before;
+		Versions[Removed] = INDEX_NONE;
+		RemainingCount--;
+
+		const FIntPoint Cell = CellCoordinate(Points[Removed]);
+		Grid[Cell.Y * GridSize + Cell.X].RemoveSingleSwap(Removed, EAllowShrinking::No);
+
+		for (int32 Each : {Before, After})
+		{
+			Candidates.HeapPush({CalculateError(Each), Each, ++Versions[Each]});
+		}
+
+		for (int32 Each : BlockedBy[Removed])
+		{
+			if (Versions[Each] != INDEX_NONE && Each != Before && Each != After)
+			{
+				Candidates.HeapPush({CalculateError(Each), Each, ++Versions[Each]});
+			}
+		}
+		BlockedBy[Removed].Empty();
+	}
+
+	if (RemainingCount == Count)
+	{
+		return 0;
+	}
+
+	TArray<FVector2D> Simplified;
+	Simplified.Reserve(RemainingCount);
+	for (int32 i = 0; i < Count; i++)
+	{
+		if (Versions[i] != INDEX_NONE)
+		{
+			Simplified.Add(Points[i]);
+		}
+	}
+
+	Points = MoveTemp(Simplified);
+	InvalidateCaches();
 
-	Points = MoveTemp(SrcToDestReplaced.Points);
+	return Count - RemainingCount;
 }
@@ -0,0 +1,478 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY
+	#include <immintrin.h>
+	#if PLATFORM_ALWAYS_HAS_AVX_2
+		#define SEGMENT_ARRAY_KERNELS_AVX2 1
+		#define SEGMENT_ARRAY_KERNELS_SSE2 0
+	#else
+		#define SEGMENT_ARRAY_KERNELS_AVX2 0
+		#define SEGMENT_ARRAY_KERNELS_SSE2 1
+	#endif
+#else
+	#define SEGMENT_ARRAY_KERNELS_AVX2 0
+	#define SEGMENT_ARRAY_KERNELS_SSE2 0
+#endif
+
+
+/**
+ * TSegmentArray2D의 점들을 X 배열과 Y 배열로 나눠서 저장한 사본
+ *
+ * 점들을 한꺼번에 훑는 계산(넓이, Bounding Box, 교차 검사 등)을 SIMD로 처리하기 위해 사용합니다.
+ * FVector2D 배열 그대로는 X와 Y가 번갈아 있어서 레지스터에 같은 축의 값만 모아서 올릴 수 없기 때문
+ */
+struct FSegmentArraySoA
+{
+	TArray<double, TAlignedHeapAllocator<32>> X;
+	TArray<double, TAlignedHeapAllocator<32>> Y;
+
+	void Build(TArrayView<const FVector2D> Points)
+	{
+		X.SetNumUninitialized(Points.Num());
+		Y.SetNumUninitialized(Points.Num());
+		for (int32 i = 0; i < Points.Num(); i++)
+		{
+			X[i] = Points[i].X;
+			Y[i] = Points[i].Y;
+		}
+	}
+
+	/**
+	 * Index가 마지막 점의 바로 다음이면 점을 추가합니다.
+	 */
+	void SetPoint(int32 Index, const FVector2D& Point)
+	{
+		if (Index == X.Num())
+		{
+			X.Add(Point.X);
+			Y.Add(Point.Y);
+		}
+		else
+		{
+			X[Index] = Point.X;
+			Y[Index] = Point.Y;
+		}
+	}
+
+	int32 Num() const
+	{
+		return X.Num();
+	}
+};
+
+
+/**
+ * FSegmentArraySoA를 대상으로 하는 SIMD 커널들
+ *
+ * AVX2를 항상 사용할 수 있는 플랫폼에서는 AVX2로, 그 외의 x86에서는 SSE2로, 나머지 플랫폼에서는 스칼라로 계산합니다.
+ * 모든 커널은 곱셈과 뺄셈을 스칼라 코드와 같은 순서로 수행하므로 (FMA를 사용하지 않음)
+ * 합산 순서가 바뀌는 넓이를 제외하면 스칼라로 계산했을 때와 결과가 같습니다.
+ */
+namespace SegmentArrayKernels
+{
+	namespace Private
+	{
+#if SEGMENT_ARRAY_KERNELS_AVX2
+		using FReg = __m256d;
+		using FMask = __m256d;
+		inline constexpr int32 LaneCount = 4;
+
+		FORCEINLINE FReg Load(const double* Ptr) { return _mm256_loadu_pd(Ptr); }
+		FORCEINLINE FReg Splat(double Value) { return _mm256_set1_pd(Value); }
+		FORCEINLINE FReg Add(FReg Left, FReg Right) { return _mm256_add_pd(Left, Right); }
+		FORCEINLINE FReg Sub(FReg Left, FReg Right) { return _mm256_sub_pd(Left, Right); }
+		FORCEINLINE FReg Mul(FReg Left, FReg Right) { return _mm256_mul_pd(Left, Right); }
+		FORCEINLINE FReg Div(FReg Left, FReg Right) { return _mm256_div_pd(Left, Right); }
+		FORCEINLINE FReg Min(FReg Left, FReg Right) { return _mm256_min_pd(Left, Right); }
+		FORCEINLINE FReg Max(FReg Left, FReg Right) { return _mm256_max_pd(Left, Right); }
+		FORCEINLINE FMask LE(FReg Left, FReg Right) { return _mm256_cmp_pd(Left, Right, _CMP_LE_OQ); }
+		FORCEINLINE FMask GT(FReg Left, FReg Right) { return _mm256_cmp_pd(Left, Right, _CMP_GT_OQ); }
+		FORCEINLINE FMask LT(FReg Left, FReg Right) { return _mm256_cmp_pd(Left, Right, _CMP_LT_OQ); }
+		FORCEINLINE FMask And(FMask Left, FMask Right) { return _mm256_and_pd(Left, Right); }
+		FORCEINLINE FMask Xor(FMask Left, FMask Right) { return _mm256_xor_pd(Left, Right); }
+		FORCEINLINE FReg Select(FMask Mask, FReg IfTrue, FReg IfFalse) { return _mm256_blendv_pd(IfFalse, IfTrue, Mask); }
+		FORCEINLINE int32 MaskBits(FMask Mask) { return _mm256_movemask_pd(Mask); }
+#elif SEGMENT_ARRAY_KERNELS_SSE2
+		using FReg = __m128d;
+		using FMask = __m128d;
+		inline constexpr int32 LaneCount = 2;
+
+		FORCEINLINE FReg Load(const double* Ptr) { return _mm_loadu_pd(Ptr); }
+		FORCEINLINE FReg Splat(double Value) { return _mm_set1_pd(Value); }
+		FORCEINLINE FReg Add(FReg Left, FReg Right) { return _mm_add_pd(Left, Right); }
+		FORCEINLINE FReg Sub(FReg Left, FReg Right) { return _mm_sub_pd(Left, Right); }
+		FORCEINLINE FReg Mul(FReg Left, FReg Right) { return _mm_mul_pd(Left, Right); }
+		FORCEINLINE FReg Div(FReg Left, FReg Right) { return _mm_div_pd(Left, Right); }
+		FORCEINLINE FReg Min(FReg Left, FReg Right) { return _mm_min_pd(Left, Right); }
+		FORCEINLINE FReg Max(FReg Left, FReg Right) { return _mm_max_pd(Left, Right); }
+		FORCEINLINE FMask LE(FReg Left, FReg Right) { return _mm_cmple_pd(Left, Right); }
+		FORCEINLINE FMask GT(FReg Left, FReg Right) { return _mm_cmpgt_pd(Left, Right); }
+		FORCEINLINE FMask LT(FReg Left, FReg Right) { return _mm_cmplt_pd(Left, Right); }
+		FORCEINLINE FMask And(FMask Left, FMask Right) { return _mm_and_pd(Left, Right); }
+		FORCEINLINE FMask Xor(FMask Left, FMask Right) { return _mm_xor_pd(Left, Right); }
+		FORCEINLINE FReg Select(FMask Mask, FReg IfTrue, FReg IfFalse) { return _mm_or_pd(_mm_and_pd(Mask, IfTrue), _mm_andnot_pd(Mask, IfFalse)); }
+		FORCEINLINE int32 MaskBits(FMask Mask) { return _mm_movemask_pd(Mask); }
+#else
+		using FReg = double;
+		using FMask = bool;
+		inline constexpr int32 LaneCount = 1;
+
+		FORCEINLINE FReg Load(const double* Ptr) { return *Ptr; }
+		FORCEINLINE FReg Splat(double Value) { return Value; }
+		FORCEINLINE FReg Add(FReg Left, FReg Right) { return Left + Right; }
+		FORCEINLINE FReg Sub(FReg Left, FReg Right) { return Left - Right; }
+		FORCEINLINE FReg Mul(FReg Left, FReg Right) { return Left * Right; }
+		FORCEINLINE FReg Div(FReg Left, FReg Right) { return Left / Right; }
+		FORCEINLINE FReg Min(FReg Left, FReg Right) { return Left < Right ? Left : Right; }
+		FORCEINLINE FReg Max(FReg Left, FReg Right) { return Left > Right ? Left : Right; }
+		FORCEINLINE FMask LE(FReg Left, FReg Right) { return Left <= Right; }
+		FORCEINLINE FMask GT(FReg Left, FReg Right) { return Left > Right; }
+		FORCEINLINE FMask LT(FReg Left, FReg Right) { return Left < Right; }
+		FORCEINLINE FMask And(FMask Left, FMask Right) { return Left && Right; }
+		FORCEINLINE FMask Xor(FMask Left, FMask Right) { return Left != Right; }
+		FORCEINLINE FReg Select(FMask Mask, FReg IfTrue, FReg IfFalse) { return Mask ? IfTrue : IfFalse; }
+		FORCEINLINE int32 MaskBits(FMask Mask) { return Mask ? 1 : 0; }
+#endif
+
+		FORCEINLINE double ReduceAdd(FReg Reg)
+		{
+			double Lanes[LaneCount];
+			FMemory::Memcpy(Lanes, &Reg, sizeof(Lanes));
+
+			double Ret = 0.;
+			for (double Each : Lanes)
+			{
+				Ret += Each;
+			}
+			return Ret;
+		}
+
+		FORCEINLINE double ReduceMin(FReg Reg)
+		{
+			double Lanes[LaneCount];
+			FMemory::Memcpy(Lanes, &Reg, sizeof(Lanes));
+
+			double Ret = Lanes[0];
+			for (double Each : Lanes)
+			{
+				Ret = FMath::Min(Ret, Each);
+			}
+			return Ret;
+		}
+
+		FORCEINLINE double ReduceMax(FReg Reg)
+		{
+			double Lanes[LaneCount];
+			FMemory::Memcpy(Lanes, &Reg, sizeof(Lanes));
+
+			double Ret = Lanes[0];
+			for (double Each : Lanes)
+			{
+				Ret = FMath::Max(Ret, Each);
+			}
+			return Ret;
+		}
+
+		/**
+		 * Start에서 End로 가는 Segment들과 Point 사이의 거리의 제곱
+		 */
+		FORCEINLINE FReg SquaredDistanceToSegments(FReg StartX, FReg StartY, FReg EndX, FReg EndY, FReg PointX, FReg PointY)
+		{
+			const FReg DirX = Sub(EndX, StartX);
+			const FReg DirY = Sub(EndY, StartY);
+			const FReg ToPointX = Sub(PointX, StartX);
+			const FReg ToPointY = Sub(PointY, StartY);
+			const FReg LengthSquared = Add(Mul(DirX, DirX), Mul(DirY, DirY));
+
+			// 길이가 0인 Segment는 시작점과의 거리를 사용 (0으로 나눠서 생긴 NaN은 Select로 버려짐)
+			const FReg Zero = Splat(0.);
+			const FReg T = Select(GT(LengthSquared, Zero),
+				Min(Max(Div(Add(Mul(ToPointX, DirX), Mul(ToPointY, DirY)), LengthSquared), Zero), Splat(1.)),
+				Zero);
+
+			const FReg DX = Sub(ToPointX, Mul(DirX, T));
+			const FReg DY = Sub(ToPointY, Mul(DirY, T));
+			return Add(Mul(DX, DX), Mul(DY, DY));
+		}
+
+		/**
+		 * 스칼라 버전의 SquaredDistanceToSegments (배열 끝에서 남는 Segment들을 처리할 때 사용)
+		 */
+		FORCEINLINE double SquaredDistanceToSegment(double StartX, double StartY, double EndX, double EndY, double PointX, double PointY)
+		{
+			const double DirX = EndX - StartX;
+			const double DirY = EndY - StartY;
+			const double ToPointX = PointX - StartX;
+			const double ToPointY = PointY - StartY;
+			const double LengthSquared = DirX * DirX + DirY * DirY;
+			const double T = LengthSquared > 0. ? FMath::Clamp((ToPointX * DirX + ToPointY * DirY) / LengthSquared, 0., 1.) : 0.;
+			const double DX = ToPointX - DirX * T;
+			const double DY = ToPointY - DirY * T;
+			return DX * DX + DY * DY;
+		}
+
+		/**
+		 * Segment i(점 i에서 점 i + 1로 가는 Segment)들에 대해 레인 단위로 Func(FirstIndex, StartX, StartY, EndX, EndY)를 호출하고
+		 * 레인에 딱 맞지 않게 남는 Segment들은 ScalarFunc(Index, StartX, StartY, EndX, EndY)로 처리합니다.
+		 * bLoop이면 마지막 점에서 첫 점으로 가는 Segment도 ScalarFunc로 처리합니다.
+		 */
+		template <typename FuncType, typename ScalarFuncType>
+		FORCEINLINE void ForEachSegmentLane(const FSegmentArraySoA& SoA, bool bLoop, const FuncType& Func, const ScalarFuncType& ScalarFunc)
+		{
+			const double* X = SoA.X.GetData();
+			const double* Y = SoA.Y.GetData();
+			const int32 OpenSegmentCount = FMath::Max(SoA.Num() - 1, 0);
+
+			int32 i = 0;
+			for (; i + LaneCount <= OpenSegmentCount; i += LaneCount)
+			{
+				Func(i, Load(X + i), Load(Y + i), Load(X + i + 1), Load(Y + i + 1));
+			}
+
+			for (; i < OpenSegmentCount; i++)
+			{
+				ScalarFunc(i, X[i], Y[i], X[i + 1], Y[i + 1]);
+			}
+
+			if (bLoop && SoA.Num() > 0)
+			{
+				ScalarFunc(SoA.Num() - 1, X[SoA.Num() - 1], Y[SoA.Num() - 1], X[0], Y[0]);
+			}
+		}
+	}
+
+	/**
+	 * 점들이 이루는 다각형의 부호 있는 넓이의 두 배를 반환합니다. (Shoelace formula, 반시계방향이면 양수)
+	 */
+	inline double CalculateSignedDoubleArea(const FSegmentArraySoA& SoA)
+	{
+		using namespace Private;
+
+		FReg Sum = Splat(0.);
+		double ScalarSum = 0.;
+		ForEachSegmentLane(SoA, true,
+			[&](int32, FReg StartX, FReg StartY, FReg EndX, FReg EndY)
+			{
+				Sum = Add(Sum, Sub(Mul(StartX, EndY), Mul(StartY, EndX)));
+			},
+			[&](int32, double StartX, double StartY, double EndX, double EndY)
+			{
+				ScalarSum += StartX * EndY - StartY * EndX;
+			});
+
+		return ReduceAdd(Sum) + ScalarSum;
+	}
+
+	inline FBox2D CalculateBoundingBox(const FSegmentArraySoA& SoA)
+	{
+		using namespace Private;
+
+		const int32 Count = SoA.Num();
+		if (Count == 0)
+		{
+			return FBox2D{ForceInit};
+		}
+
+		const double* X = SoA.X.GetData();
+		const double* Y = SoA.Y.GetData();
+
+		FReg MinX = Splat(X[0]);
+		FReg MinY = Splat(Y[0]);
+		FReg MaxX = MinX;
+		FReg MaxY = MinY;
+
+		int32 i = 0;
+		for (; i + LaneCount <= Count; i += LaneCount)
+		{
+			const FReg EachX = Load(X + i);
+			const FReg EachY = Load(Y + i);
+			MinX = Min(MinX, EachX);
+			MinY = Min(MinY, EachY);
+			MaxX = Max(MaxX, EachX);
+			MaxY = Max(MaxY, EachY);
+		}
+
+		FVector2D RetMin{ReduceMin(MinX), ReduceMin(MinY)};
+		FVector2D RetMax{ReduceMax(MaxX), ReduceMax(MaxY)};
+		for (; i < Count; i++)
+		{
+			RetMin = FVector2D{FMath::Min(RetMin.X, X[i]), FMath::Min(RetMin.Y, Y[i])};
+			RetMax = FVector2D{FMath::Max(RetMax.X, X[i]), FMath::Max(RetMax.Y, Y[i])};
+		}
+
+		return {RetMin, RetMax};
+	}
+
+	/**
+	 * 점들이 이루는 다각형 안에 Point가 있는지 반환합니다. TSegmentArray2D::IsInside와 같은 Crossing Number 알고리즘이며
+	 * 변의 Y 범위를 반열린 구간으로 취급하는 것과 변과의 거리가 UE_KINDA_SMALL_NUMBER 이내인 점을 안쪽으로 취급하는 것도 같습니다.
+	 */
+	inline bool IsInside(const FSegmentArraySoA& SoA, const FVector2D& Point)
+	{
+		using namespace Private;
+
+		// 스칼라 버전과 정확히 같은 값을 사용해야 경계에서 결과가 일치함 (UE_KINDA_SMALL_NUMBER는 float)
+		const double Tolerance = UE_KINDA_SMALL_NUMBER;
+		const double ToleranceSquared = UE_KINDA_SMALL_NUMBER * UE_KINDA_SMALL_NUMBER;
+
+		const FReg PointX = Splat(Point.X);
+		const FReg PointY = Splat(Point.Y);
+		const FReg Zero = Splat(0.);
+		const FReg ToleranceReg = Splat(Tolerance);
+		const FReg ToleranceSquaredReg = Splat(ToleranceSquared);
+
+		bool bOnEdge = false;
+		int32 CrossingCount = 0;
+
+		ForEachSegmentLane(SoA, true,
+			[&](int32, FReg StartX, FReg StartY, FReg EndX, FReg EndY)
+			{
+				const FMask InYRange = And(
+					LE(Sub(Min(StartY, EndY), ToleranceReg), PointY),
+					LE(PointY, Add(Max(StartY, EndY), ToleranceReg)));
+
+				const FReg EdgeX = Sub(EndX, StartX);
+				const FReg EdgeY = Sub(EndY, StartY);
+				const FReg Cross = Sub(Mul(EdgeX, Sub(PointY, StartY)), Mul(EdgeY, Sub(PointX, StartX)));
+
+				const FMask OnEdge = And(And(InYRange,
+						LE(Mul(Cross, Cross), Mul(ToleranceSquaredReg, Add(Mul(EdgeX, EdgeX), Mul(EdgeY, EdgeY))))),
+					And(LE(Sub(Min(StartX, EndX), ToleranceReg), PointX),
+						LE(PointX, Add(Max(StartX, EndX), ToleranceReg))));
+
+				const FMask Straddles = Xor(GT(StartY, PointY), GT(EndY, PointY));
+				const FMask CrossesRight = Select(GT(EdgeY, Zero), GT(Cross, Zero), LT(Cross, Zero));
+
+				bOnEdge |= MaskBits(OnEdge) != 0;
+				CrossingCount += FMath::CountBits(static_cast<uint64>(MaskBits(And(Straddles, CrossesRight))));
+			},
+			[&](int32, double StartX, double StartY, double EndX, double EndY)
+			{
+				if (Point.Y < FMath::Min(StartY, EndY) - Tolerance || Point.Y > FMath::Max(StartY, EndY) + Tolerance)
+				{
+					return;
+				}
+
+				const double EdgeX = EndX - StartX;
+				const double EdgeY = EndY - StartY;
+				const double Cross = EdgeX * (Point.Y - StartY) - EdgeY * (Point.X - StartX);
+
+				if (Cross * Cross <= ToleranceSquared * (EdgeX * EdgeX + EdgeY * EdgeY)
+					&& Point.X >= FMath::Min(StartX, EndX) - Tolerance
+					&& Point.X <= FMath::Max(StartX, EndX) + Tolerance)
+				{
+					bOnEdge = true;
+				}
+				else if ((StartY > Point.Y) != (EndY > Point.Y) && (EdgeY > 0. ? Cross > 0. : Cross < 0.))
+				{
+					CrossingCount++;
+				}
+			});
+
+		return bOnEdge || CrossingCount % 2 == 1;
+	}
+
+	/**
+	 * AABB가 Box와 겹칠 수 있는 Segment들의 인덱스에 대해 오름차순으로 Func를 호출합니다.
+	 * FSegmentSpatialIndex2D와 마찬가지로 AABB를 약간 넓혀서 검사하므로 실제로는 겹치지 않는 Segment가 섞여 있을 수 있습니다.
+	 */
+	template <typename FuncType>
+	void ForEachSegmentOverlapping(const FSegmentArraySoA& SoA, bool bLoop, const FBox2D& Box, const FuncType& Func)
+	{
+		using namespace Private;
+
+		const double Tolerance = UE_KINDA_SMALL_NUMBER;
+		const FReg BoxMinX = Splat(Box.Min.X);
+		const FReg BoxMinY = Splat(Box.Min.Y);
+		const FReg BoxMaxX = Splat(Box.Max.X);
+		const FReg BoxMaxY = Splat(Box.Max.Y);
+		const FReg ToleranceReg = Splat(Tolerance);
+		const FReg One = Splat(1.);
+
+		ForEachSegmentLane(SoA, bLoop,
+			[&](int32 FirstIndex, FReg StartX, FReg StartY, FReg EndX, FReg EndY)
+			{
+				const FReg MinX = Min(StartX, EndX);
+				const FReg MinY = Min(StartY, EndY);
+				const FReg MaxX = Max(StartX, EndX);
+				const FReg MaxY = Max(StartY, EndY);
+				const FReg Padding = Mul(ToleranceReg, Max(One, Max(Sub(MaxX, MinX), Sub(MaxY, MinY))));
+
+				const FMask Overlaps = And(
+					And(LE(Sub(MinX, Padding), BoxMaxX), LE(BoxMinX, Add(MaxX, Padding))),
+					And(LE(Sub(MinY, Padding), BoxMaxY), LE(BoxMinY, Add(MaxY, Padding))));
+
+				for (int32 Bits = MaskBits(Overlaps); Bits != 0; Bits &= Bits - 1)
+				{
+					Func(FirstIndex + static_cast<int32>(FMath::CountTrailingZeros(static_cast<uint32>(Bits))));
+				}
+			},
+			[&](int32 Index, double StartX, double StartY, double EndX, double EndY)
+			{
+				const double MinX = FMath::Min(StartX, EndX);
+				const double MinY = FMath::Min(StartY, EndY);
+				const double MaxX = FMath::Max(StartX, EndX);
+				const double MaxY = FMath::Max(StartY, EndY);
+				const double Padding = Tolerance * FMath::Max(1., FMath::Max(MaxX - MinX, MaxY - MinY));
+
+				if (MinX - Padding <= Box.Max.X && Box.Min.X <= MaxX + Padding
+					&& MinY - Padding <= Box.Max.Y && Box.Min.Y <= MaxY + Padding)
+				{
+					Func(Index);
+				}
+			});
+	}
+
+	/**
+	 * Point와 가장 가까운 Segment일 수 있는 Segment들의 인덱스에 대해 오름차순으로 Func를 호출합니다.
+	 *
+	 * 먼저 모든 Segment와의 거리의 제곱을 SIMD로 계산해서 최솟값을 구한 다음
+	 * 최솟값과 float 오차 범위 안에서 같은 Segment들만 Func로 넘겨줍니다.
+	 * TSegmentArray2D::FindClosestPointTo는 거리의 제곱을 float로 비교하므로 이 후보들만 정확하게 다시 검사하면 결과가 같습니다.
+	 */
+	template <typename FuncType>
+	void ForEachSegmentNear(const FSegmentArraySoA& SoA, bool bLoop, const FVector2D& Point, const FuncType& Func)
+	{
+		using namespace Private;
+
+		const FReg PointX = Splat(Point.X);
+		const FReg PointY = Splat(Point.Y);
+
+		FReg MinDistanceSquared = Splat(TNumericLimits<double>::Max());
+		double ScalarMinDistanceSquared = TNumericLimits<double>::Max();
+		ForEachSegmentLane(SoA, bLoop,
+			[&](int32, FReg StartX, FReg StartY, FReg EndX, FReg EndY)
+			{
+				MinDistanceSquared = Min(MinDistanceSquared, SquaredDistanceToSegments(StartX, StartY, EndX, EndY, PointX, PointY));
+			},
+			[&](int32, double StartX, double StartY, double EndX, double EndY)
+			{
+				ScalarMinDistanceSquared = FMath::Min(ScalarMinDistanceSquared, SquaredDistanceToSegment(StartX, StartY, EndX, EndY, Point.X, Point.Y));
+			});
+
+		// float의 상대 오차(약 6e-8)보다 충분히 넓게 잡고 점이 Segment 위에 있을 때를 위해 절대 오차도 더함
+		const double Threshold = FMath::Min(ReduceMin(MinDistanceSquared), ScalarMinDistanceSquared) * (1. + 1e-5) + 1e-8;
+		const FReg ThresholdReg = Splat(Threshold);
+
+		ForEachSegmentLane(SoA, bLoop,
+			[&](int32 FirstIndex, FReg StartX, FReg StartY, FReg EndX, FReg EndY)
+			{
+				const FMask Near = LE(SquaredDistanceToSegments(StartX, StartY, EndX, EndY, PointX, PointY), ThresholdReg);
+				for (int32 Bits = MaskBits(Near); Bits != 0; Bits &= Bits - 1)
+				{
+					Func(FirstIndex + static_cast<int32>(FMath::CountTrailingZeros(static_cast<uint32>(Bits))));
+				}
+			},
+			[&](int32 Index, double StartX, double StartY, double EndX, double EndY)
+			{
+				if (SquaredDistanceToSegment(StartX, StartY, EndX, EndY, Point.X, Point.Y) <= Threshold)
+				{
+					Func(Index);
+				}
+			});
+	}
+}
@@ -0,0 +1,137 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SegmentArray.h"
+
+
+/**
+ * 여러 주인(KeyType)의 Segment들을 고정 크기 격자 칸에 나눠 담아두는 Spatial Hash
+ *
+ * FSegmentSpatialIndex2D는 Segment 배열 하나에 대한 트리라서 배열이 여러 개면 배열마다 따로 쿼리해야 하지만
+ * 이 클래스는 주인이 여러 명인 Segment들을 한 곳에 모아두므로 쿼리 한 번으로 모든 주인의 Segment를 검사할 수 있습니다.
+ * Segment는 추가만 할 수 있고 주인 단위로만 제거할 수 있습니다. (트레이서처럼 뒤에 계속 붙다가 한 번에 사라지는 경우를 위함)
+ */
+template <typename KeyType>
+class TSegmentSpatialHash2D
+{
+public:
+	explicit TSegmentSpatialHash2D(double InCellSize)
+		: CellSize(InCellSize)
+	{
+		check(CellSize > 0.);
+	}
+
+	/**
+	 * Key가 주인인 SegmentIndex번째 Segment를 추가합니다.
+	 */
+	void Add(const KeyType& Key, int32 SegmentIndex, const FRawSegment2D& Segment)
+	{
+		const FCellRange Range = ToCellRange(Segment);
+		TSet<FIntPoint>& KeyCells = CellsByKey.FindOrAdd(Key);
+
+		for (int32 Y = Range.Min.Y; Y <= Range.Max.Y; Y++)
+		{
+			for (int32 X = Range.Min.X; X <= Range.Max.X; X++)
+			{
+				Cells.FindOrAdd({X, Y}).Add({Key, SegmentIndex, Segment});
+				KeyCells.Add({X, Y});
+			}
+		}
+	}
+
+	/**
+	 * Key가 주인인 모든 Segment를 제거합니다.
+	 */
+	void Remove(const KeyType& Key)
+	{
+		const TSet<FIntPoint>* KeyCells = CellsByKey.Find(Key);
+		if (!KeyCells)
+		{
+			return;
+		}
+
+		for (const FIntPoint& Each : *KeyCells)
+		{
+			if (TArray<FItem>* Items = Cells.Find(Each))
+			{
+				Items->RemoveAllSwap([&](const FItem& Item) { return Item.Key == Key; });
+
+				// 빈 칸을 남겨두면 트레이서가 지나간 모든 칸이 쌓이므로 바로 지움
+				if (Items->IsEmpty())
+				{
+					Cells.Remove(Each);
+				}
+			}
+		}
+
+		CellsByKey.Remove(Key);
+	}
+
+	/**
+	 * Segment와 교차하는 모든 Segment에 대해 Func(Key, SegmentIndex)를 한 번씩 호출합니다.
+	 * 교차 판정은 TSegmentArray2D::FindIntersection과 같음
+	 */
+	template <typename FuncType>
+	void ForEachIntersecting(const FRawSegment2D& Segment, const FuncType& Func) const
+	{
+		const FCellRange Range = ToCellRange(Segment);
+
+		for (int32 Y = Range.Min.Y; Y <= Range.Max.Y; Y++)
+		{
+			for (int32 X = Range.Min.X; X <= Range.Max.X; X++)
+			{
+				const TArray<FItem>* Items = Cells.Find({X, Y});
+				if (!Items)
+				{
+					continue;
+				}
+
+				for (const FItem& Each : *Items)
+				{
+					// 여러 칸에 걸친 Segment는 두 범위가 겹치는 첫 칸에서만 검사해서 중복 호출을 막음
+					const FIntPoint ItemMin = ToCellRange(Each.Segment).Min;
+					const FIntPoint FirstSharedCell{FMath::Max(ItemMin.X, Range.Min.X), FMath::Max(ItemMin.Y, Range.Min.Y)};
+					if (FirstSharedCell == FIntPoint{X, Y} && Each.Segment.Intersects(Segment))
+					{
+						Func(Each.Key, Each.SegmentIndex);
+					}
+				}
+			}
+		}
+	}
+
+	bool IsEmpty() const
+	{
+		return Cells.Num() == 0;
+	}
+
+private:
+	struct FItem
+	{
+		KeyType Key;
+		int32 SegmentIndex;
+		FRawSegment2D Segment;
+	};
+
+	struct FCellRange
+	{
+		FIntPoint Min;
+		FIntPoint Max;
+	};
+
+	double CellSize;
+	TMap<FIntPoint, TArray<FItem>> Cells;
+	TMap<KeyType, TSet<FIntPoint>> CellsByKey;
+
+	FCellRange ToCellRange(const FRawSegment2D& Segment) const
+	{
+		// 교차 판정이 허용하는 오차만큼 넉넉한 AABB를 사용해서 칸 경계에서 교차를 놓치지 않도록 함
+		const FBox2D Bounds = FSegmentSpatialIndex2D::MakeSegmentBounds(Segment.Start, Segment.End);
+		return {
+			FIntPoint{FMath::FloorToInt(Bounds.Min.X / CellSize), FMath::FloorToInt(Bounds.Min.Y / CellSize)},
+			FIntPoint{FMath::FloorToInt(Bounds.Max.X / CellSize), FMath::FloorToInt(Bounds.Max.Y / CellSize)},
+		};
+	}
+};
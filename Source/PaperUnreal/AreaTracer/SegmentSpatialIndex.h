@@ -0,0 +1,313 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+ * Segment 배열의 각 Segment AABB를 모아 만든 Bounding Volume Hierarchy
+ *
+ * TSegmentArray2D가 교차 검사나 최단 거리 검색을 할 때 모든 Segment를 훑지 않도록 후보 Segment를 추려주는 용도입니다.
+ * 후보만 추려줄 뿐 실제 교차 검사는 하지 않으므로 후보에 실제로는 교차하지 않는 Segment나 중복이 섞여 있을 수 있습니다.
+ *
+ * 트리를 만든 이후에 모양이 바뀌거나 배열 끝에 추가된 Segment는 트리를 다시 만드는 대신 Pending 목록에 넣어두고
+ * 모든 쿼리에서 무조건 후보로 방문합니다. (트리 안의 오래된 AABB는 남아있지만 후보가 늘어날 뿐 결과는 틀리지 않음)
+ * Pending 목록이 너무 커지면 NeedsRebuild가 true를 반환하므로 그 때 Build를 다시 호출하면 됩니다.
+ */
+class FSegmentSpatialIndex2D
+{
+public:
+	/**
+	 * 파라미터로 주어진 점들로 트리를 새로 만듭니다.
+	 *
+	 * @param bLoop 마지막 점과 첫 점을 잇는 Segment가 존재하는지 여부 (TSegmentArray2D의 bLoop와 같음)
+	 */
+	void Build(TArrayView<const FVector2D> Points, bool bLoop)
+	{
+		Nodes.Reset();
+		Items.Reset();
+		Pending.Reset();
+
+		const int32 SegmentCount = bLoop ? Points.Num() : FMath::Max(Points.Num() - 1, 0);
+		IndexedSegmentCount = SegmentCount;
+
+		if (SegmentCount == 0)
+		{
+			return;
+		}
+
+		TArray<FBox2D> SegmentBounds;
+		TArray<FVector2D> Centers;
+		SegmentBounds.Reserve(SegmentCount);
+		Centers.Reserve(SegmentCount);
+		Items.Reserve(SegmentCount);
+		for (int32 i = 0; i < SegmentCount; i++)
+		{
+			const FVector2D& Start = Points[i];
+			const FVector2D& End = Points[i + 1 < Points.Num() ? i + 1 : 0];
+			SegmentBounds.Add(MakeSegmentBounds(Start, End));
+			Centers.Add((Start + End) * 0.5);
+			Items.Add(i);
+		}
+
+		Nodes.Reserve(2 * SegmentCount / LeafSize + 1);
+		Nodes.AddDefaulted();
+		BuildNode(0, 0, SegmentCount, SegmentBounds, Centers);
+	}
+
+	/**
+	 * 트리를 만들 때와 모양이 달라진 Segment를 알려줍니다.
+	 * 트리를 만든 이후에 배열 끝에 새로 추가된 Segment도 이 함수로 알려주면 됩니다.
+	 * 중간 삽입이나 삭제처럼 Segment 인덱스가 밀리는 변경은 이 함수로 처리할 수 없으므로 Build를 다시 호출해야 합니다.
+	 */
+	void MarkSegmentDirty(int32 SegmentIndex)
+	{
+		if (!Pending.Contains(SegmentIndex))
+		{
+			Pending.Add(SegmentIndex);
+		}
+	}
+
+	/**
+	 * Pending 목록이 커져서 트리를 새로 만드는 게 이득인지 여부를 반환합니다.
+	 */
+	bool NeedsRebuild() const
+	{
+		return Pending.Num() > MaxPendingBase + IndexedSegmentCount / 8;
+	}
+
+	/**
+	 * AABB가 Box와 겹치는 모든 Segment의 인덱스에 대해 Func를 호출합니다.
+	 */
+	template <typename FuncType>
+	void ForEachOverlapping(const FBox2D& Box, const FuncType& Func) const
+	{
+		for (int32 Each : Pending)
+		{
+			Func(Each);
+		}
+
+		Traverse([&](const FBox2D& NodeBounds) { return BoxesOverlap(NodeBounds, Box); }, Func);
+	}
+
+	/**
+	 * Origin에서 Direction으로 무한히 뻗어나가는 레이가 AABB를 지나는 모든 Segment의 인덱스에 대해 Func를 호출합니다.
+	 */
+	template <typename FuncType>
+	void ForEachAlongRay(const FVector2D& Origin, const FVector2D& Direction, const FuncType& Func) const
+	{
+		for (int32 Each : Pending)
+		{
+			Func(Each);
+		}
+
+		Traverse([&](const FBox2D& NodeBounds) { return RayOverlapsBox(Origin, Direction, NodeBounds); }, Func);
+	}
+
+	/**
+	 * Point에 가까운 노드부터 차례로 Segment의 인덱스에 대해 Func를 호출합니다.
+	 *
+	 * 노드를 방문하기 전에 노드의 AABB와 Point 사이의 거리의 제곱(노드 안의 모든 Segment까지의 거리의 제곱의 하한)으로 CanSkip을 호출해서
+	 * true가 반환되면 해당 노드를 통째로 건너뜁니다. 즉 CanSkip은 지금까지 찾은 최단 거리보다 확실히 먼 거리인지를 반환하면 됩니다.
+	 */
+	template <typename CanSkipFuncType, typename FuncType>
+	void ForEachNearest(const FVector2D& Point, const CanSkipFuncType& CanSkip, const FuncType& Func) const
+	{
+		for (int32 Each : Pending)
+		{
+			Func(Each);
+		}
+
+		if (Nodes.IsEmpty())
+		{
+			return;
+		}
+
+		TArray<int32, TInlineAllocator<64>> Stack;
+		Stack.Add(0);
+
+		while (!Stack.IsEmpty())
+		{
+			const FNode& Node = Nodes[Stack.Pop()];
+
+			if (CanSkip(SquaredDistanceToBox(Point, Node.Bounds)))
+			{
+				continue;
+			}
+
+			if (Node.IsLeaf())
+			{
+				for (int32 i = Node.FirstIndex; i < Node.FirstIndex + Node.Count; i++)
+				{
+					Func(Items[i]);
+				}
+				continue;
+			}
+
+			// 가까운 자식을 나중에 넣어서 먼저 방문하게 함 (먼저 방문할수록 CanSkip에서 걸러지는 노드가 많아짐)
+			const int32 Left = Node.FirstIndex;
+			const int32 Right = Node.FirstIndex + 1;
+			const bool bLeftIsCloser = SquaredDistanceToBox(Point, Nodes[Left].Bounds) <= SquaredDistanceToBox(Point, Nodes[Right].Bounds);
+			Stack.Add(bLeftIsCloser ? Right : Left);
+			Stack.Add(bLeftIsCloser ? Left : Right);
+		}
+	}
+
+	/**
+	 * 이 트리가 Segment마다 저장하는 AABB를 반환합니다.
+	 * 교차 검사들이 경계에서 약간의 오차를 허용하므로 그보다 넉넉하게 키워서 후보에서 빠지는 Segment가 없도록 함
+	 */
+	static FBox2D MakeSegmentBounds(const FVector2D& Start, const FVector2D& End)
+	{
+		const FVector2D Min{FMath::Min(Start.X, End.X), FMath::Min(Start.Y, End.Y)};
+		const FVector2D Max{FMath::Max(Start.X, End.X), FMath::Max(Start.Y, End.Y)};
+		const double Padding = UE_KINDA_SMALL_NUMBER * FMath::Max(1., (Max - Min).GetMax());
+		return {Min - FVector2D{Padding, Padding}, Max + FVector2D{Padding, Padding}};
+	}
+
+private:
+	static constexpr int32 LeafSize = 4;
+	static constexpr int32 MaxPendingBase = 16;
+
+	struct FNode
+	{
+		FBox2D Bounds{ForceInit};
+
+		/**
+		 * Leaf면 Items 배열 내의 시작 위치, 아니면 왼쪽 자식 노드의 인덱스 (오른쪽 자식은 바로 다음 인덱스)
+		 */
+		int32 FirstIndex = 0;
+
+		/**
+		 * Leaf가 가진 Segment의 개수, Leaf가 아니면 0
+		 */
+		int32 Count = 0;
+
+		bool IsLeaf() const { return Count > 0; }
+	};
+
+	TArray<FNode> Nodes;
+	TArray<int32> Items;
+	TArray<int32> Pending;
+	int32 IndexedSegmentCount = 0;
+
+	static bool BoxesOverlap(const FBox2D& Left, const FBox2D& Right)
+	{
+		return Left.Min.X <= Right.Max.X && Right.Min.X <= Left.Max.X
+			&& Left.Min.Y <= Right.Max.Y && Right.Min.Y <= Left.Max.Y;
+	}
+
+	static double SquaredDistanceToBox(const FVector2D& Point, const FBox2D& Box)
+	{
+		const double DX = FMath::Max3(Box.Min.X - Point.X, 0., Point.X - Box.Max.X);
+		const double DY = FMath::Max3(Box.Min.Y - Point.Y, 0., Point.Y - Box.Max.Y);
+		return DX * DX + DY * DY;
+	}
+
+	static bool RayOverlapsBox(const FVector2D& Origin, const FVector2D& Direction, const FBox2D& Box)
+	{
+		double TMin = 0.;
+		double TMax = TNumericLimits<double>::Max();
+
+		for (int32 Axis = 0; Axis < 2; Axis++)
+		{
+			const double O = Origin[Axis];
+			const double D = Direction[Axis];
+			const double BoxMin = Box.Min[Axis];
+			const double BoxMax = Box.Max[Axis];
+
+			if (D == 0.)
+			{
+				if (O < BoxMin || O > BoxMax)
+				{
+					return false;
+				}
+				continue;
+			}
+
+			const double T0 = (BoxMin - O) / D;
+			const double T1 = (BoxMax - O) / D;
+			TMin = FMath::Max(TMin, FMath::Min(T0, T1));
+			TMax = FMath::Min(TMax, FMath::Max(T0, T1));
+
+			if (TMin > TMax)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void BuildNode(int32 NodeIndex, int32 First, int32 Count, const TArray<FBox2D>& SegmentBounds, const TArray<FVector2D>& Centers)
+	{
+		FBox2D Bounds{ForceInit};
+		FBox2D CenterBounds{ForceInit};
+		for (int32 i = First; i < First + Count; i++)
+		{
+			Bounds += SegmentBounds[Items[i]];
+			CenterBounds += Centers[Items[i]];
+		}
+		Nodes[NodeIndex].Bounds = Bounds;
+
+		if (Count <= LeafSize)
+		{
+			Nodes[NodeIndex].FirstIndex = First;
+			Nodes[NodeIndex].Count = Count;
+			return;
+		}
+
+		// 중심점들이 가장 넓게 퍼진 축으로 절반씩 나눔
+		const FVector2D CenterSpread = CenterBounds.GetSize();
+		const int32 Axis = CenterSpread.X >= CenterSpread.Y ? 0 : 1;
+		const int32 Half = Count / 2;
+		int32* ItemData = Items.GetData();
+		std::nth_element(ItemData + First, ItemData + First + Half, ItemData + First + Count, [&](int32 Left, int32 Right)
+		{
+			return Centers[Left][Axis] < Centers[Right][Axis];
+		});
+
+		// 두 자식은 항상 연속된 인덱스에 위치함
+		const int32 LeftIndex = Nodes.AddDefaulted(2);
+		Nodes[NodeIndex].FirstIndex = LeftIndex;
+		Nodes[NodeIndex].Count = 0;
+
+		BuildNode(LeftIndex, First, Half, SegmentBounds, Centers);
+		BuildNode(LeftIndex + 1, First + Half, Count - Half, SegmentBounds, Centers);
+	}
+
+	template <typename OverlapFuncType, typename FuncType>
+	void Traverse(const OverlapFuncType& Overlaps, const FuncType& Func) const
+	{
+		if (Nodes.IsEmpty())
+		{
+			return;
+		}
+
+		TArray<int32, TInlineAllocator<64>> Stack;
+		Stack.Add(0);
+
+		while (!Stack.IsEmpty())
+		{
+			const FNode& Node = Nodes[Stack.Pop()];
+
+			if (!Overlaps(Node.Bounds))
+			{
+				continue;
+			}
+
+			if (Node.IsLeaf())
+			{
+				for (int32 i = Node.FirstIndex; i < Node.FirstIndex + Node.Count; i++)
+				{
+					Func(Items[i]);
+				}
+				continue;
+			}
+
+			Stack.Add(Node.FirstIndex);
+			Stack.Add(Node.FirstIndex + 1);
+		}
+	}
+};
@@ -0,0 +1,85 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+ * 두 Segment 집합 사이의 교차 후보를 한 번에 찾는 Sweep 함수들
+ *
+ * 한 쪽 집합의 Segment마다 다른 쪽 집합 전체를 검사하는 대신 두 집합의 AABB를 x축으로 한 번만 훑으면서
+ * x 구간이 겹치는 상대편 AABB만 검사합니다. (Red / Blue 교차 검사)
+ */
+namespace SegmentSweep
+{
+	/**
+	 * Red와 Blue에서 서로 겹치는 모든 AABB 쌍에 대해 Func(RedIndex, BlueIndex)를 호출합니다.
+	 * 같은 집합 내의 쌍은 검사하지 않으며 호출 순서는 정해져 있지 않습니다.
+	 */
+	template <typename FuncType>
+	void ForEachOverlappingPair(TArrayView<const FBox2D> Red, TArrayView<const FBox2D> Blue, const FuncType& Func)
+	{
+		if (Red.IsEmpty() || Blue.IsEmpty())
+		{
+			return;
+		}
+
+		struct FEvent
+		{
+			double MinX;
+			int32 Index;
+			bool bBlue;
+		};
+
+		TArray<FEvent> Events;
+		Events.Reserve(Red.Num() + Blue.Num());
+		for (int32 i = 0; i < Red.Num(); i++)
+		{
+			Events.Add({Red[i].Min.X, i, false});
+		}
+		for (int32 i = 0; i < Blue.Num(); i++)
+		{
+			Events.Add({Blue[i].Min.X, i, true});
+		}
+
+		Events.Sort([](const FEvent& Left, const FEvent& Right) { return Left.MinX < Right.MinX; });
+
+		// 현재 Sweep 위치에 x 구간이 걸쳐 있을 수 있는 AABB들
+		// 지나간 AABB는 상대편이 검사할 때 발견해서 그 자리에서 제거함
+		TArray<int32, TInlineAllocator<32>> ActiveRed;
+		TArray<int32, TInlineAllocator<32>> ActiveBlue;
+
+		for (const FEvent& Event : Events)
+		{
+			const FBox2D& Box = Event.bBlue ? Blue[Event.Index] : Red[Event.Index];
+			auto& Opposite = Event.bBlue ? ActiveRed : ActiveBlue;
+			const TArrayView<const FBox2D> OppositeBoxes = Event.bBlue ? Red : Blue;
+
+			for (int32 i = 0; i < Opposite.Num();)
+			{
+				const FBox2D& Other = OppositeBoxes[Opposite[i]];
+				if (Other.Max.X < Event.MinX)
+				{
+					Opposite.RemoveAtSwap(i);
+					continue;
+				}
+
+				if (Other.Min.Y <= Box.Max.Y && Box.Min.Y <= Other.Max.Y)
+				{
+					if (Event.bBlue)
+					{
+						Func(Opposite[i], Event.Index);
+					}
+					else
+					{
+						Func(Event.Index, Opposite[i]);
+					}
+				}
+				i++;
+			}
+
+			(Event.bBlue ? ActiveBlue : ActiveRed).Add(Event.Index);
+		}
+	}
+}
@@ -0,0 +1,66 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "TracerCollisionSubsystem.h"
+
+#include "TracerOverlapCheckerComponent.h"
+#include "Async/ParallelFor.h"
+
+
+void UTracerCollisionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 게임 스레드에서 이번 프레임의 이동들을 연속된 배열에 모음, 서브스텝을 사용하면 폰 하나에 이동이 여러 개일 수 있음
+	TArray<UTracerOverlapCheckerComponent*> Movers;
+	TArray<int32> MovementOffsets{0};
+	TArray<FRawSegment2D> Movements;
+	TArray<int32> LastSelfSegmentIndices;
+	for (UTracerOverlapCheckerComponent* Each : OverlapCheckers)
+	{
+		if (!IsValid(Each))
+		{
+			continue;
+		}
+
+		Each->ConsumeMovements(Movements, LastSelfSegmentIndices);
+		if (Movements.Num() > MovementOffsets.Last())
+		{
+			Movers.Add(Each);
+			MovementOffsets.Add(Movements.Num());
+		}
+	}
+
+	// 워커 스레드들에서 교차 검사, 여기서는 아무것도 수정하지 않으므로 락이 필요 없음
+	TArray<FTracerBumpResult> Results;
+	Results.SetNum(Movers.Num());
+	ParallelFor(Movers.Num(), [&](int32 MoverIndex)
+	{
+		FTracerBumpResult& Result = Results[MoverIndex];
+		const UTracerPathComponent* Instigator = Movers[MoverIndex]->OverlapInstigator;
+
+		for (int32 i = MovementOffsets[MoverIndex]; i < MovementOffsets[MoverIndex + 1]; i++)
+		{
+			ForEachIntersecting(Movements[i], [&](UTracerPathComponent* Tracer, int32 SegmentIndex)
+			{
+				if (Tracer == Instigator)
+				{
+					Result.bBumpedIntoSelf |= SegmentIndex <= LastSelfSegmentIndices[i];
+				}
+				else
+				{
+					Result.BumpedTracers.AddUnique(Tracer);
+				}
+			});
+		}
+	}, Movements.Num() < ParallelMinMovementCount);
+
+	// 게임 스레드에서 등록 순서대로 이벤트 적용, 이벤트가 트레이서를 죽일 수 있으므로 매번 유효성을 다시 확인함
+	for (int32 i = 0; i < Movers.Num(); i++)
+	{
+		if (IsValid(Movers[i]))
+		{
+			Movers[i]->ApplyBumpResult(Results[i]);
+		}
+	}
+}
@@ -0,0 +1,144 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SegmentSpatialHash.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TracerCollisionSubsystem.generated.h"
+
+
+class UTracerPathComponent;
+class UTracerOverlapCheckerComponent;
+
+
+/**
+ * 이동 하나에 대한 충돌 검사 결과
+ */
+struct FTracerBumpResult
+{
+	/**
+	 * 방금 지나온 Segment를 제외한 자기 자신의 트레이서와 부딪혔는지 여부
+	 */
+	bool bBumpedIntoSelf = false;
+
+	/**
+	 * 부딪힌 다른 트레이서들, 충돌 대상인지는 거르지 않음
+	 */
+	TArray<UTracerPathComponent*, TInlineAllocator<4>> BumpedTracers;
+};
+
+
+/**
+ * 월드에 있는 모든 트레이서의 Segment를 한 곳에 모아두고 이동 Segment와 교차하는 트레이서를 찾아주는 서브시스템
+ *
+ * 트레이서의 마지막 Segment는 매 프레임 늘어나거나 방향이 바뀌므로 Spatial Hash에 넣지 않고 따로 들고 있다가 쿼리마다 직접 검사하고
+ * 새 점이 추가되어 더 이상 바뀌지 않게 된 Segment만 Spatial Hash에 넣습니다.
+ * 따라서 쿼리 비용이 트레이서의 길이나 개수에 거의 비례하지 않습니다.
+ *
+ * 등록된 UTracerOverlapCheckerComponent들의 충돌 검사는 각자 틱하지 않고 이 서브시스템이 매 프레임 한 번에 처리합니다.
+ * 모든 컴포넌트 틱이 끝난 다음에 이동들을 모아서 워커 스레드들에서 나눠 검사하고 결과는 게임 스레드에서 등록 순서대로 적용하므로
+ * 결과가 컴포넌트들의 틱 순서나 스레드 스케줄링에 따라 달라지지 않습니다.
+ */
+UCLASS()
+class UTracerCollisionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void RegisterOverlapChecker(UTracerOverlapCheckerComponent* Checker)
+	{
+		OverlapCheckers.AddUnique(Checker);
+	}
+
+	void UnregisterOverlapChecker(UTracerOverlapCheckerComponent* Checker)
+	{
+		// 등록 순서가 곧 이벤트 적용 순서이므로 순서를 유지하며 제거함
+		OverlapCheckers.Remove(Checker);
+	}
+
+	/**
+	 * Tracer의 Path 끝에 점이 추가되었음을 알립니다.
+	 */
+	void OnPointAdded(UTracerPathComponent* Tracer, const FSegmentArray2D& Path)
+	{
+		if (Path.SegmentCount() >= 2)
+		{
+			SettledSegments.Add(Tracer, Path.SegmentCount() - 2, Path.GetRawSegment(-2));
+		}
+
+		OnLastPointMoved(Tracer, Path);
+	}
+
+	/**
+	 * Tracer의 Path의 마지막 점이 움직였음을 알립니다.
+	 */
+	void OnLastPointMoved(UTracerPathComponent* Tracer, const FSegmentArray2D& Path)
+	{
+		if (Path.SegmentCount() >= 1)
+		{
+			HeadSegments.FindOrAdd(Tracer) = {Path.SegmentCount() - 1, Path.GetRawSegment(-1)};
+		}
+		else
+		{
+			HeadSegments.Remove(Tracer);
+		}
+	}
+
+	/**
+	 * Tracer의 Path가 비워졌음을 알립니다.
+	 */
+	void OnPathCleared(UTracerPathComponent* Tracer)
+	{
+		SettledSegments.Remove(Tracer);
+		HeadSegments.Remove(Tracer);
+	}
+
+	/**
+	 * Movement와 교차하는 모든 트레이서 Segment에 대해 Func(Tracer, SegmentIndex)를 호출합니다.
+	 * Func 안에서 트레이서를 수정하면 안 됩니다. 트레이서가 수정되지 않는 동안에는 여러 스레드에서 동시에 호출해도 됩니다.
+	 */
+	template <typename FuncType>
+	void ForEachIntersecting(const FRawSegment2D& Movement, const FuncType& Func) const
+	{
+		SettledSegments.ForEachIntersecting(Movement, Func);
+
+		for (const auto& Each : HeadSegments)
+		{
+			if (Each.Value.Segment.Intersects(Movement))
+			{
+				Func(Each.Key, Each.Value.SegmentIndex);
+			}
+		}
+	}
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(UTracerCollisionSubsystem, STATGROUP_Tickables);
+	}
+
+private:
+	/**
+	 * 이동이 이보다 적으면 워커 스레드에 나눠주는 비용이 더 크므로 게임 스레드에서 바로 검사함
+	 */
+	static constexpr int32 ParallelMinMovementCount = 8;
+
+	/**
+	 * 트레이서의 점 간격(10)과 폰이 한 프레임에 움직이는 거리보다 충분히 크게 잡아서 쿼리 하나가 방문하는 칸이 몇 개 되지 않도록 함
+	 */
+	static constexpr double CellSize = 200.;
+
+	struct FHeadSegment
+	{
+		int32 SegmentIndex;
+		FRawSegment2D Segment;
+	};
+
+	TSegmentSpatialHash2D<UTracerPathComponent*> SettledSegments{CellSize};
+	TMap<UTracerPathComponent*, FHeadSegment> HeadSegments;
+
+	UPROPERTY()
+	TArray<UTracerOverlapCheckerComponent*> OverlapCheckers;
+};
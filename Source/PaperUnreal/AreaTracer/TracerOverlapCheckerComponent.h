@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "TracerCollisionSubsystem.h"
 #include "TracerPathComponent.h"
 #include "TracerOverlapCheckerComponent.generated.h"
 
@@ -33,18 +34,20 @@ public:
 	}
 
 private:
+	friend class UTracerCollisionSubsystem;
+
 	UPROPERTY()
 	UTracerPathComponent* OverlapInstigator;
 
 	UPROPERTY()
 	TSet<UTracerPathComponent*> OverlapTargets;
 
-	TTickingValue<FVector2D> CheckPoint;
+	TOptional<FVector2D> LastLocation;
+	uint64 LastConsumedFrame = 0;
 
 	UTracerOverlapCheckerComponent()
 	{
 		bWantsInitializeComponent = true;
-		PrimaryComponentTick.bCanEverTick = true;
 	}
 
 	virtual void InitializeComponent() override
@@ -52,44 +55,64 @@ private:
 		Super::InitializeComponent();
 
 		AddLifeDependency(OverlapInstigator);
+
+		// 각자 틱하지 않고 서브시스템이 모든 폰의 충돌 검사를 한 번에 처리함
+		if (UTracerCollisionSubsystem* Collision = GetWorld()->GetSubsystem<UTracerCollisionSubsystem>())
+		{
+			Collision->RegisterOverlapChecker(this);
+		}
+	}
+
+	virtual void UninitializeComponent() override
+	{
+		if (UTracerCollisionSubsystem* Collision = GetWorld()->GetSubsystem<UTracerCollisionSubsystem>())
+		{
+			Collision->UnregisterOverlapChecker(this);
+		}
+
+		Super::UninitializeComponent();
 	}
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override
+	/**
+	 * 트레이서가 마지막 틱에 Path를 만들며 지나온 이동 Segment들을 OutMovements에 추가합니다.
+	 * 각 Segment와 함께 해당 시점에 방금 지나온 것으로 보고 제외해야 하는 자기 자신의 Segment 인덱스의 경계도 추가합니다.
+	 */
+	void ConsumeMovements(TArray<FRawSegment2D>& OutMovements, TArray<int32>& OutLastSelfSegmentIndices)
 	{
-		Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+		// 트레이서가 이번 프레임에 틱하지 않았으면 지난 프레임의 위치들을 다시 쓰지 않음
+		if (OverlapInstigator->GetLastTickFrame() == LastConsumedFrame)
+		{
+			return;
+		}
+		LastConsumedFrame = OverlapInstigator->GetLastTickFrame();
 
-		CheckPoint.Tick(FVector2D{GetOwner()->GetActorLocation()});
-		
-		CheckPoint.OverTwoTicks([&](const FVector2D& LastTick, const FVector2D& ThisTick)
+		for (const UTracerPathComponent::FSubstep& Each : OverlapInstigator->GetLastTickSubsteps())
 		{
-			const FSegment2D Movement{LastTick, ThisTick};
-			
-			if (Movement.Length() > UE_KINDA_SMALL_NUMBER)
+			if (LastLocation)
 			{
-				OnMaybeOverlappingSelf(Movement);
-				OnMaybeOverlappingTarget(Movement);
+				const FRawSegment2D Movement{*LastLocation, Each.Location};
+				if (Movement.SquaredLength() > FMath::Square(UE_KINDA_SMALL_NUMBER))
+				{
+					// 방금 지나온 자기 자신의 마지막 두 Segment와는 항상 닿아 있으므로 제외함 (그 이후에 생긴 Segment도 마찬가지)
+					OutMovements.Add(Movement);
+					OutLastSelfSegmentIndices.Add(Each.SegmentCount - 3);
+				}
 			}
-		});
+
+			LastLocation = Each.Location;
+		}
 	}
 
-	void OnMaybeOverlappingSelf(const FSegment2D& Movement)
+	void ApplyBumpResult(const FTracerBumpResult& Result)
 	{
-		// TODO fix
-		const int32 SegmentCount = OverlapInstigator->GetRunningPath().SegmentCount();
-		if (SegmentCount >= 3
-			&& OverlapInstigator->GetRunningPath()
-			                    .SubArray(0, SegmentCount - 3)
-			                    .FindIntersection(Movement))
+		if (Result.bBumpedIntoSelf)
 		{
 			OnTracerBumpedInto.Broadcast(OverlapInstigator);
 		}
-	}
 
-	void OnMaybeOverlappingTarget(const FSegment2D& Movement)
-	{
 		for (UTracerPathComponent* Each : OverlapTargets)
 		{
-			if (IsValid(Each) && Each->GetRunningPath().FindIntersection(Movement))
+			if (IsValid(Each) && Result.BumpedTracers.Contains(Each))
 			{
 				OnTracerBumpedInto.Broadcast(Each);
 			}
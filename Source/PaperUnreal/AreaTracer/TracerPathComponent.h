@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "AreaBoundaryComponent.h"
+#include "AreaContainmentTracker.h"
+#include "MovementSubstepper.h"
+#include "TracerCollisionSubsystem.h"
 #include "TracerPathProvider.h"
 #include "TracerPathComponent.generated.h"
 
@@ -22,7 +25,51 @@ public:
 	const FSegmentArray2D& GetRunningPath() const { return Path; }
 
 	// TODO remove dependency
-	void SetNoPathArea(UAreaBoundaryComponent* Area) { NoPathArea = Area; }
+	void SetNoPathArea(UAreaBoundaryComponent* Area)
+	{
+		NoPathArea = Area;
+		OwnerInNoPathArea.Invalidate();
+
+		if (IsValid(Area))
+		{
+			Area->GetBoundary().Observe(this, [this, Area](const FLoopedSegmentArray2D&)
+			{
+				if (NoPathArea == Area)
+				{
+					OwnerInNoPathArea.Invalidate();
+				}
+			});
+		}
+	}
+
+	/**
+	 * 프레임 사이의 중간 위치들을 복원해서 Path 생성과 충돌 검사에 사용할 시간 간격을 설정합니다.
+	 * 서버 틱 레이트를 낮춰도 트레이서 모양과 충돌 결과가 크게 달라지지 않게 하기 위함, FMovementSubstepper 참고
+	 *
+	 * @param Seconds 0 이하면 프레임 끝 위치만 사용함
+	 */
+	void SetSubstepInterval(float Seconds) { Substepper.SetInterval(Seconds); }
+
+	struct FSubstep
+	{
+		FVector2D Location;
+
+		/**
+		 * 이 위치까지 Path를 만든 직후의 Path의 Segment 개수
+		 */
+		int32 SegmentCount;
+	};
+
+	/**
+	 * 마지막 틱에서 Path를 만드는 데 사용한 위치들을 시간 순서대로 반환합니다.
+	 * 마지막 위치는 항상 그 틱의 액터 위치입니다.
+	 */
+	TArrayView<const FSubstep> GetLastTickSubsteps() const { return LastTickSubsteps; }
+
+	/**
+	 * GetLastTickSubsteps가 만들어진 프레임 번호
+	 */
+	uint64 GetLastTickFrame() const { return LastTickFrame; }
 
 	void ClearPath() { EmptyPoints(); }
 
@@ -48,6 +95,11 @@ private:
 	FSegmentArray2D Path;
 
 	FTickingSwitch Switch;
+	FAreaContainmentTracker OwnerInNoPathArea;
+
+	FMovementSubstepper Substepper;
+	TArray<FSubstep> LastTickSubsteps;
+	uint64 LastTickFrame = 0;
 
 	UTracerPathComponent()
 	{
@@ -66,16 +118,30 @@ private:
 	{
 		Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+		LastTickSubsteps.Reset();
+		LastTickFrame = GFrameCounter;
+
+		const FVector2D ActorLocation2D{GetOwner()->GetActorLocation()};
+		Substepper.Tick(ActorLocation2D, FVector2D{GetOwner()->GetVelocity()}, DeltaTime, [&](const FVector2D& Location)
+		{
+			TickSubstep(Location);
+			LastTickSubsteps.Add({Location, Path.SegmentCount()});
+		});
+	}
+
+	void TickSubstep(const FVector2D& Location)
+	{
 		const bool bAlwaysGenerate = !IsValid(NoPathArea);
 		const bool bAreaHasNonZeroArea = IsValid(NoPathArea) && NoPathArea->IsValid();
-		const bool bOwnerIsOutsideArea = IsValid(NoPathArea) && !NoPathArea->IsInside(GetOwner()->GetActorLocation());
+		const bool bOwnerIsOutsideArea = bAreaHasNonZeroArea
+			&& !OwnerInNoPathArea.Update(NoPathArea->GetBoundary().Get(), Location);
 		const bool bGeneratePath = bAlwaysGenerate || (bAreaHasNonZeroArea && bOwnerIsOutsideArea);
 
 		Switch.Tick(bGeneratePath);
 
 		Switch.IfTrueThisFrame([&]()
 		{
-			Generate();
+			Generate(Location);
 		});
 
 		Switch.IfSwitchedOnThisFrame([&]()
@@ -95,8 +161,7 @@ private:
 		if (IsValid(NoPathArea) && NoPathArea->IsValid())
 		{
 			const FVector2D Attached = NoPathArea->FindClosestPointOnBoundary2D(Path.GetPoint(-1)).GetPoint();
-			Path.SetPoint(-1, Attached);
-			PathHead.SetValue(Attached);
+			MoveLastPoint(Attached);
 		}
 	}
 
@@ -106,6 +171,22 @@ private:
 		Path.AddPoint(Location);
 		PathTail.Add(Location);
 		PathHead.SetValue(Location);
+
+		if (UTracerCollisionSubsystem* Collision = FindCollisionSubsystem())
+		{
+			Collision->OnPointAdded(this, Path);
+		}
+	}
+
+	void MoveLastPoint(const FVector2D& Location)
+	{
+		Path.SetPoint(-1, Location);
+		PathHead.SetValue(Location);
+
+		if (UTracerCollisionSubsystem* Collision = FindCollisionSubsystem())
+		{
+			Collision->OnLastPointMoved(this, Path);
+		}
 	}
 
 	void EmptyPoints()
@@ -113,19 +194,29 @@ private:
 		PathHead.SetValue(TOptional<FVector2D>{});
 		PathTail.Empty();
 		LastCompletePath.SetValueNoComparison(MoveTemp(Path));
+
+		if (UTracerCollisionSubsystem* Collision = FindCollisionSubsystem())
+		{
+			Collision->OnPathCleared(this);
+		}
 	}
 
-	void Generate()
+	UTracerCollisionSubsystem* FindCollisionSubsystem() const
 	{
-		const FVector2D ActorLocation2D{GetOwner()->GetActorLocation()};
+		// 클라이언트에서 확장을 예측하는 트레이서는 충돌 검사에 참여하지 않음
+		const UWorld* World = GetWorld();
+		return World && GetNetMode() != NM_Client ? World->GetSubsystem<UTracerCollisionSubsystem>() : nullptr;
+	}
 
+	void Generate(const FVector2D& Location)
+	{
 		if (Path.PointCount() == 0)
 		{
-			AddPoint(ActorLocation2D);
+			AddPoint(Location);
 			return;
 		}
 
-		const float Dist = (Path.GetPoint(-1) - ActorLocation2D).Length();
+		const float Dist = (Path.GetPoint(-1) - Location).Length();
 		if (Dist < 10.f)
 		{
 			return;
@@ -133,7 +224,7 @@ private:
 
 		if (Path.PointCount() < 3)
 		{
-			AddPoint(ActorLocation2D);
+			AddPoint(Location);
 			return;
 		}
 
@@ -141,7 +232,7 @@ private:
 		{
 			const FVector2D& Position0 = Path.GetPoint(-2);
 			const FVector2D& Position1 = Path.GetPoint(-1);
-			const FVector2D& Position2 = ActorLocation2D;
+			const FVector2D& Position2 = Location;
 
 			const float ASideLength = (Position1 - Position2).Length();
 			const float BSideLength = (Position0 - Position2).Length();
@@ -157,7 +248,7 @@ private:
 
 		const float CurrentDeviation = [&]()
 		{
-			const FVector2D DeviatingVector = ActorLocation2D - Path.GetPoint(-2);
+			const FVector2D DeviatingVector = Location - Path.GetPoint(-2);
 			const FVector2D StraightVector = Path.GetSegmentDirection(-2);
 			const FVector2D Proj = StraightVector * DeviatingVector.Dot(StraightVector);
 			return (DeviatingVector - Proj).Length();
@@ -165,12 +256,11 @@ private:
 
 		if (Curvature > 0.005f || CurrentDeviation > 1.f)
 		{
-			AddPoint(ActorLocation2D);
+			AddPoint(Location);
 		}
 		else
 		{
-			Path.SetPoint(-1, ActorLocation2D);
-			PathHead.SetValue(ActorLocation2D);
+			MoveLastPoint(Location);
 		}
 	}
 };
@@ -0,0 +1,128 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SegmentArray.h"
+
+
+/**
+ * 트레이서의 어느 부분을 언제 영역으로 변환할지 정하는 클래스
+ *
+ * 진행 중인 트레이서의 끝 Segment가 경계를 가로지를 때와 트레이서가 완성됐을 때 변환을 예약하고
+ * 마지막으로 변환한 부분이 끝난 지점을 기억해서 다음 변환에는 그 이후의 Path만 사용합니다.
+ * 완성된 트레이서를 진행 중일 때 이미 끝까지 변환했으면 (영역 밖으로 나갔다가 다시 들어온 경우) 다시 변환하지 않습니다.
+ */
+class FTracerToAreaConversionQueue
+{
+public:
+	/**
+	 * 진행 중인 트레이서의 끝이 움직였을 때 호출합니다.
+	 *
+	 * @return 끝 Segment가 경계를 가로질러서 변환이 예약되었는지 여부
+	 */
+	bool OnRunningPathHeadMoved(const FSegmentArray2D& RunningPath, const FLoopedSegmentArray2D& Boundary)
+	{
+		// 첫 Segment는 경계 위에서 시작하고 마지막으로 변환한 Segment는 이미 경계와 만나므로 그 이후의 Segment만 봄
+		const int32 HeadSegmentIndex = RunningPath.SegmentCount() - 1;
+		const bool bCrossed = HeadSegmentIndex > LastCrossingSegmentIndex
+			&& Boundary.FindIntersection(RunningPath.GetRawSegment(HeadSegmentIndex)).IsSet();
+
+		// 변환이 꺼내지기 전에 Path가 더 길어질 수 있으므로 가로지른 Segment를 지금 기억해둠
+		if (bCrossed)
+		{
+			PendingCrossingSegmentIndex = HeadSegmentIndex;
+		}
+		return bCrossed;
+	}
+
+	/**
+	 * 트레이서가 완성됐을 때 호출합니다. 진행 중이던 트레이서에 대한 기록은 모두 버립니다.
+	 */
+	void OnPathCompleted(const FSegmentArray2D& CompletePath)
+	{
+		// 마지막으로 가로지른 Segment 이후로 Segment가 없으면 진행 중일 때 이미 끝까지 변환한 것임
+		const int32 LastSegmentIndex = CompletePath.SegmentCount() - 1;
+		if (LastCrossingSegmentIndex == 0 || LastSegmentIndex > LastCrossingSegmentIndex)
+		{
+			PendingCompletePath = CutAfterLastCrossing(CompletePath, LastSegmentIndex);
+		}
+		else
+		{
+			PendingCompletePath.Reset();
+		}
+
+		PendingCrossingSegmentIndex = INDEX_NONE;
+		LastCrossingSegmentIndex = 0;
+		LastCrossingPoint.Reset();
+	}
+
+	/**
+	 * 예약된 변환 중 다음에 변환할 Path를 꺼냅니다. 완성된 트레이서가 진행 중인 트레이서보다 먼저입니다.
+	 *
+	 * @param RunningPath 진행 중인 트레이서, 진행 중인 트레이서의 변환이 예약된 경우에만 사용하며 예약된 이후로 점이 더 추가되어 있어도 됨
+	 * @param Boundary 변환할 영역의 현재 경계
+	 */
+	TOptional<FSegmentArray2D> Pop(const FSegmentArray2D& RunningPath, const FLoopedSegmentArray2D& Boundary)
+	{
+		if (PendingCompletePath)
+		{
+			TOptional<FSegmentArray2D> Ret = MoveTemp(PendingCompletePath);
+			PendingCompletePath.Reset();
+			return Ret;
+		}
+
+		if (PendingCrossingSegmentIndex == INDEX_NONE)
+		{
+			return {};
+		}
+
+		const int32 CrossingSegmentIndex = PendingCrossingSegmentIndex;
+		PendingCrossingSegmentIndex = INDEX_NONE;
+
+		FSegmentArray2D NewPortion = CutAfterLastCrossing(RunningPath, CrossingSegmentIndex);
+
+		// 다음 변환은 이번에 가로지른 Segment가 경계를 마지막으로 빠져나간 지점부터 시작함
+		const FRawSegment2D CrossingSegment = RunningPath.GetRawSegment(CrossingSegmentIndex);
+		double ExitAlpha = -1.;
+		for (const FLoopedSegmentArray2D::FIntersection& Each : Boundary.FindAllIntersections(CrossingSegment))
+		{
+			ExitAlpha = FMath::Max(ExitAlpha, CrossingSegment.ProjectUnitRange(Each.Location(Boundary)));
+		}
+
+		LastCrossingSegmentIndex = CrossingSegmentIndex;
+		LastCrossingPoint = ExitAlpha >= 0. ? CrossingSegment.PointBetween(ExitAlpha) : TOptional<FVector2D>{};
+
+		return NewPortion;
+	}
+
+private:
+	/**
+	 * 변환이 예약된 진행 중인 트레이서의 Segment 중 경계를 마지막으로 가로지른 Segment의 인덱스, 예약된 변환이 없으면 INDEX_NONE
+	 */
+	int32 PendingCrossingSegmentIndex = INDEX_NONE;
+
+	TOptional<FSegmentArray2D> PendingCompletePath;
+
+	/**
+	 * 진행 중인 트레이서에서 마지막으로 영역으로 변환한 부분이 끝난 Segment의 인덱스와 그 Segment가 경계를 빠져나간 지점
+	 * 다음 변환에는 이 지점 이후의 Path만 사용하므로 Union이 이미 변환한 부분을 다시 훑지 않음
+	 */
+	int32 LastCrossingSegmentIndex = 0;
+	TOptional<FVector2D> LastCrossingPoint;
+
+	FSegmentArray2D CutAfterLastCrossing(const FSegmentArray2D& Path, int32 LastSegmentIndex) const
+	{
+		if (LastCrossingSegmentIndex == 0 || LastCrossingSegmentIndex > LastSegmentIndex)
+		{
+			return Path;
+		}
+
+		FSegmentArray2D Ret = Path.SubArray(LastCrossingSegmentIndex, LastSegmentIndex);
+		if (LastCrossingPoint)
+		{
+			Ret.SetPoint(0, *LastCrossingPoint);
+		}
+		return Ret;
+	}
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "TracerPathComponent.h"
+#include "TracerToAreaConversionQueue.h"
 #include "PaperUnreal/WeakCoroutine/WeakCoroutine.h"
 #include "TracerToAreaConverterComponent.generated.h"
 
@@ -48,6 +49,11 @@ private:
 
 	bool bAreaExpansionAlreadyPending = false;
 
+	/**
+	 * 다른 확장이 진행 중이라 아직 변환하지 못한 Path들
+	 */
+	FTracerToAreaConversionQueue ConversionQueue;
+
 	UTracerToAreaConverterComponent()
 	{
 		bWantsInitializeComponent = true;
@@ -60,29 +66,40 @@ private:
 		AddLifeDependency(Tracer);
 		AddLifeDependency(ConversionDestination);
 
-		ConversionDestination->GetBoundary().Observe(this, [this](auto&)
+		// 경계가 바뀔 때마다 Path 전체로 Union을 시도하지 않고 트레이서의 끝 Segment가 경계를 가로지를 때만 변환함
+		Tracer->GetRunningPathHead().ObserveIfValid(this, [this](const FVector2D&)
 		{
-			ConvertPathToArea(Tracer->GetRunningPath());
+			if (ConversionQueue.OnRunningPathHeadMoved(Tracer->GetRunningPath(), ConversionDestination->GetBoundary().Get()))
+			{
+				ConvertPendingPaths();
+			}
 		});
 
 		Tracer->GetLastCompletePath().ObserveIfValid(this, [this](const FSegmentArray2D& CompletePath)
 		{
-			ConvertPathToArea(CompletePath);
+			ConversionQueue.OnPathCompleted(CompletePath);
+			ConvertPendingPaths();
 		});
 	}
 
-	void ConvertPathToArea(const FSegmentArray2D& Path)
+	void ConvertPendingPaths()
 	{
 		if (bAreaExpansionAlreadyPending)
 		{
 			return;
 		}
 
+		if (TOptional<FSegmentArray2D> Path = ConversionQueue.Pop(Tracer->GetRunningPath(), ConversionDestination->GetBoundary().Get()))
+		{
+			ConvertPathToArea(MoveTemp(*Path));
+		}
+	}
+
+	void ConvertPathToArea(FSegmentArray2D Path)
+	{
 		bAreaExpansionAlreadyPending = true;
 
-		// TODO 여기 Path = Path를 쓰지 않으면 const ref로 캡쳐돼서 MoveTemp에서 컴파일러 에러 발생함
-		// 컴파일러 버그인지 coroutine lambda가 mutable일 때 capture의 특수 상황인지에 대해 조사 필요
-		RunWeakCoroutine(this, [this, Path = Path]() mutable -> FWeakCoroutine
+		RunWeakCoroutine(this, [this, Path = MoveTemp(Path)]() mutable -> FWeakCoroutine
 		{
 			using FExpansionResult = UAreaBoundaryComponent::FExpansionResult;
 			for (const FExpansionResult& Each : co_await ConversionDestination->ExpandByPath(MoveTemp(Path)))
@@ -90,6 +107,9 @@ private:
 				OnTracerToAreaConversion.Broadcast(Each.CorrectlyAlignedPath);
 			}
 			bAreaExpansionAlreadyPending = false;
+
+			// 확장하는 동안 들어온 변환 요청을 처리함
+			ConvertPendingPaths();
 		});
 	}
 };
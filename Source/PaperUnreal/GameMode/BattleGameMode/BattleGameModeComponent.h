@@ -158,10 +158,13 @@ private:
 			co_return;
 		}
 
+		// 스폰하자마자 영역 밖으로 나가버리지 않도록 경계에서 조금 떨어진 곳에 스폰
+		constexpr float SpawnMinDistanceFromEdge = 50.f;
+
 		UE_LOG(LogBattleGameMode, Log, TEXT("%p 플레이어 폰을 스폰합니다"), Player);
 		APawn* Pawn = GameStateComponent->ServerPawnSpawner->SpawnAtLocation(
 			GetDefaultPawnClass(),
-			ThisPlayerArea->ServerAreaBoundary->GetRandomPointInside(),
+			ThisPlayerArea->ServerAreaBoundary->GetRandomPointInside(SpawnMinDistanceFromEdge),
 			[&](APawn* ToInit)
 			{
 				auto PawnComponent = NewObject<UBattlePawnComponent>(ToInit);
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/GameStateBase.h"
+#include "PaperUnreal/AreaTracer/AreaInteractionSubsystem.h"
 #include "PaperUnreal/AreaTracer/AreaSpawnerComponent.h"
 #include "PaperUnreal/GameFramework2/ComponentGroupComponent.h"
 #include "PaperUnreal/GameMode/ModeAgnostic/PawnSpawnerComponent.h"
@@ -196,6 +197,23 @@ private:
 		InitiateLiveAreasFeeder();
 	}
 
+	void SetAreaLive(AAreaActor* Area, bool bLive)
+	{
+		// 살아있는 영역들끼리만 서로 자르거나 먹을 수 있음
+		UAreaInteractionSubsystem* AreaInteractions = GetWorld()->GetSubsystem<UAreaInteractionSubsystem>();
+
+		if (bLive)
+		{
+			LiveAreas.Add(Area);
+			AreaInteractions->RegisterArea(Area->ServerAreaBoundary);
+		}
+		else
+		{
+			LiveAreas.Remove(Area);
+			AreaInteractions->UnregisterArea(Area->ServerAreaBoundary);
+		}
+	}
+
 	FWeakCoroutine InitiateLiveAreasFeeder()
 	{
 		co_await AreaSpawner;
@@ -209,12 +227,12 @@ private:
 
 				FDelegateSPHandle Handle = Area->LifeComponent->GetbAlive().Observe([this, Area](bool bAlive)
 				{
-					bAlive ? LiveAreas.Add(Area) : LiveAreas.Remove(Area);
+					SetAreaLive(Area, bAlive);
 				});
 
 				co_await AreaSpawner->GetSpawnedAreas().WaitForElementToBeRemoved(Area);
 
-				LiveAreas.Remove(Area);
+				SetAreaLive(Area, false);
 			});
 		});
 	}
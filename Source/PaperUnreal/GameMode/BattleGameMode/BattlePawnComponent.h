@@ -7,7 +7,7 @@
 #include "BattlePawnKillerComponent.h"
 #include "BattlePlayerStateComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "PaperUnreal/AreaTracer/AreaSlasherComponent.h"
+#include "PaperUnreal/AreaTracer/AreaInteractionSubsystem.h"
 #include "PaperUnreal/AreaTracer/AreaSpawnerComponent.h"
 #include "PaperUnreal/AreaTracer/ReplicatedTracerPathComponent.h"
 #include "PaperUnreal/AreaTracer/TracerComponent.h"
@@ -39,6 +39,7 @@ public:
 		check(!HasBeenInitialized());
 		ServerGameState = InGameState;
 		ServerHomeArea = InHomeArea;
+		HomeArea = InHomeArea;
 	}
 
 private:
@@ -56,13 +57,29 @@ private:
 	UFUNCTION()
 	void OnRep_Life() { Life.Notify(); }
 
+	/**
+	 * 소유한 클라이언트가 영역 확장을 예측할 때 사용함
+	 */
+	UPROPERTY(ReplicatedUsing=OnRep_HomeArea)
+	AAreaActor* RepHomeArea;
+	TLiveData<AAreaActor*&> HomeArea{RepHomeArea};
+
+	UFUNCTION()
+	void OnRep_HomeArea() { HomeArea.Notify(); }
+
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override
 	{
 		Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 		DOREPLIFETIME_CONDITION(ThisClass, RepTracer, COND_InitialOnly);
 		DOREPLIFETIME_CONDITION(ThisClass, RepLife, COND_InitialOnly);
+		DOREPLIFETIME_CONDITION(ThisClass, RepHomeArea, COND_OwnerOnly);
 	}
 
+	/**
+	 * 서버 틱 레이트가 이보다 낮아도 트레이서 모양과 충돌 결과가 달라지지 않도록 함
+	 */
+	static constexpr float TracerSubstepInterval = 1.f / 30.f;
+
 	UPROPERTY()
 	AAreaActor* ServerHomeArea;
 
@@ -91,6 +108,8 @@ private:
 		Tracer->RegisterComponent();
 		Tracer->ServerTracerPath->SetNoPathArea(ServerHomeArea->ServerAreaBoundary);
 
+		Tracer->ServerTracerPath->SetSubstepInterval(TracerSubstepInterval);
+
 		ServerOverlapChecker = NewChildComponent<UTracerOverlapCheckerComponent>(GetOwner());
 		ServerOverlapChecker->SetTracer(Tracer->ServerTracerPath);
 		ServerOverlapChecker->RegisterComponent();
@@ -121,24 +140,8 @@ private:
 		ServerTracerToAreaConverter->SetConversionDestination(ServerHomeArea->ServerAreaBoundary);
 		ServerTracerToAreaConverter->RegisterComponent();
 
-		RunWeakCoroutine(this, [this]() -> FWeakCoroutine
-		{
-			co_await AddToWeakList(ServerTracerToAreaConverter);
-			co_await AddToWeakList(ServerHomeArea);
-
-			auto AreaStream
-				= ServerGameState->GetLiveAreas().MakeAddStream()
-				| Awaitables::IfNot(ServerHomeArea);
-
-			while (true)
-			{
-				auto NewArea = co_await AreaStream;
-				auto AreaSlasher = NewChildComponent<UAreaSlasherComponent>(GetOwner());
-				AreaSlasher->SetSlashTarget(NewArea->ServerAreaBoundary);
-				AreaSlasher->SetTracerToAreaConverter(ServerTracerToAreaConverter);
-				AreaSlasher->RegisterComponent();
-			}
-		});
+		// 내 영역이 확장될 때 다른 영역들이 잘려나가는 처리는 서브시스템이 모든 영역에 대해 한 번에 함
+		GetWorld()->GetSubsystem<UAreaInteractionSubsystem>()->AddExpansionSource(ServerTracerToAreaConverter);
 
 		auto Killer = NewChildComponent<UBattlePawnKillerComponent>(GetOwner());
 		Killer->SetTracer(Tracer->ServerTracerPath);
@@ -182,6 +185,12 @@ private:
 			Tracer->SetTracerColorStream(Inventory->GetTracerBaseColor().MakeStream());
 		});
 
+		// HomeArea는 소유한 클라이언트에게만 복제되므로 다른 클라이언트의 폰은 예측을 시작하지 않음
+		if (GetNetMode() == NM_Client)
+		{
+			InitiateAreaExpansionPrediction();
+		}
+
 		RunWeakCoroutine(this, [this]() -> FWeakCoroutine
 		{
 			TStrongObjectPtr ExplosionActorClass{(co_await RequestAsyncLoad(FAssetPaths::SoftExplosionActor())).Unsafe()};
@@ -193,4 +202,31 @@ private:
 			GetWorld()->SpawnActorAbsolute(ExplosionActorClass.Get(), GetOwner()->GetActorTransform());
 		});
 	}
+
+	/**
+	 * 서버와 똑같은 트레이서와 변환 컴포넌트를 클라이언트에서도 돌려서 서버의 경계가 도착하기 전에 영역 확장을 보여줌
+	 * 서버의 경계와 맞춰보는 것은 UAreaBoundaryPredictorComponent가 담당함
+	 */
+	void InitiateAreaExpansionPrediction()
+	{
+		RunWeakCoroutine(this, [this]() -> FWeakCoroutine
+		{
+			auto Area = co_await HomeArea;
+
+			// 영역 액터가 아직 플레이어 머신 컴포넌트를 붙이지 않았을 수 있으므로 Predictor가 생길 때까지 기다림
+			auto Predictor = co_await Area->GetClientAreaBoundaryPredictor();
+
+			auto LocalTracerPath = NewChildComponent<UTracerPathComponent>(GetOwner());
+			LocalTracerPath->SetNoPathArea(Area->ClientPredictedAreaBoundary);
+			LocalTracerPath->SetSubstepInterval(TracerSubstepInterval);
+			LocalTracerPath->RegisterComponent();
+
+			auto LocalTracerToAreaConverter = NewChildComponent<UTracerToAreaConverterComponent>(GetOwner());
+			LocalTracerToAreaConverter->SetTracer(LocalTracerPath);
+			LocalTracerToAreaConverter->SetConversionDestination(Area->ClientPredictedAreaBoundary);
+			LocalTracerToAreaConverter->RegisterComponent();
+
+			Predictor->AddPredictionSource(LocalTracerToAreaConverter);
+		});
+	}
 };
@@ -0,0 +1,104 @@
+#include "TestBoundaryShapes.h"
+#include "Misc/AutomationTest.h"
+#include "PaperUnreal/AreaTracer/AreaBoundaryDelta.h"
+#include "PaperUnreal/AreaTracer/SegmentArray.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AreaBoundaryDeltaTest, "PaperUnreal.PaperUnreal.Test.AreaBoundaryDeltaTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool AreaBoundaryDeltaTest::RunTest(const FString& Parameters)
+{
+	using TestBoundaryShapes::MakeCircle;
+
+	const auto TestRoundTrip = [&](const TCHAR* What, const TArray<FVector2D>& Old, const TArray<FVector2D>& New)
+	{
+		const FAreaBoundaryDelta Delta = FAreaBoundaryDelta::Make(Old, New);
+		const TOptional<TArray<FVector2D>> Applied = Delta.Apply(Old);
+		TestTrue(What, Applied && *Applied == New);
+		return Delta;
+	};
+
+	{
+		const TArray<FVector2D> Circle = MakeCircle({0., 0.}, 100., 256);
+		TestTrue(TEXT("TestCase 1: 같은 배열"), TestRoundTrip(TEXT("TestCase 1: 같은 배열"), Circle, Circle).IsEmpty());
+		TestEqual(TEXT("TestCase 1: 빈 배열에서 시작"), TestRoundTrip(TEXT("TestCase 1: 빈 배열에서 시작"), {}, Circle).GetPointCount(), 256);
+		TestEqual(TEXT("TestCase 1: 빈 배열로 끝남"), TestRoundTrip(TEXT("TestCase 1: 빈 배열로 끝남"), Circle, {}).GetPointCount(), 0);
+	}
+
+	{
+		const TArray<FVector2D> Circle = MakeCircle({0., 0.}, 100., 256);
+		const TArray<FVector2D> Bump{{200., 10.}, {200., -10.}};
+
+		// 배열의 끝과 처음에 걸친 구간을 교체하면 남은 점들이 앞으로 밀려나도 새 점만 보냄
+		FLoopedSegmentArray2D Wrapped{Circle};
+		Wrapped.ReplacePoints(250, 5, Bump);
+		const FAreaBoundaryDelta WrappedDelta = TestRoundTrip(TEXT("TestCase 2: 끝과 처음에 걸친 교체"), Circle, Wrapped.GetPoints());
+		TestEqual(TEXT("TestCase 2: 끝과 처음에 걸친 교체"), WrappedDelta.GetPointCount(), 2);
+
+		FLoopedSegmentArray2D Inserted{Circle};
+		Inserted.InsertPoints(100, Bump);
+		const FAreaBoundaryDelta InsertedDelta = TestRoundTrip(TEXT("TestCase 2: 삽입"), Circle, Inserted.GetPoints());
+		TestEqual(TEXT("TestCase 2: 삽입"), InsertedDelta.GetPointCount(), 2);
+		TestEqual(TEXT("TestCase 2: 삽입"), InsertedDelta.Splices.Num(), 1);
+
+		FLoopedSegmentArray2D Reversed{Circle};
+		Reversed.ReverseVertexOrder();
+		TestRoundTrip(TEXT("TestCase 2: 순서 뒤집기"), Circle, Reversed.GetPoints());
+	}
+
+	{
+		// 영역을 여러 번 확장하고 단순화해도 매번 바뀐 구간의 점들만 보냄
+		FLoopedSegmentArray2D Boundary{MakeCircle({0., 0.}, 100., 512)};
+		TArray<FVector2D> Replicated = Boundary.GetPoints();
+		int32 MaxPointCount = 0;
+		bool bAllEqual = true;
+
+		// 실패했을 때 같은 확장들로 다시 돌려볼 수 있도록 시드를 고정함
+		const FRandomStream Random{20240917};
+
+		for (int32 i = 0; i < 32; i++)
+		{
+			const double Angle = 2. * UE_PI * Random.FRand();
+			const double Width = 0.05 + 0.1 * Random.FRand();
+			const double Radius = 100. + 5. * i;
+			const FVector2D From{FMath::Cos(Angle), FMath::Sin(Angle)};
+			const FVector2D To{FMath::Cos(Angle + Width), FMath::Sin(Angle + Width)};
+			Boundary.Union(FSegmentArray2D{{From * (Radius - 10.), From * (Radius + 20.), To * (Radius + 20.), To * (Radius - 10.)}});
+			Boundary.Simplify(1.f);
+
+			const FAreaBoundaryDelta Delta = FAreaBoundaryDelta::Make(Replicated, Boundary.GetPoints());
+			TOptional<TArray<FVector2D>> Applied = Delta.Apply(Replicated);
+			Replicated = Applied ? MoveTemp(*Applied) : TArray<FVector2D>{};
+			bAllEqual &= Replicated == Boundary.GetPoints();
+			MaxPointCount = FMath::Max(MaxPointCount, Delta.GetPointCount());
+		}
+
+		TestTrue(TEXT("TestCase 3: 확장 반복"), bAllEqual);
+		TestTrue(TEXT("TestCase 3: 확장 반복"), Boundary.CalculateArea() > UE_PI * 100. * 100.);
+		TestTrue(TEXT("TestCase 3: 확장 반복"), MaxPointCount <= 8);
+	}
+
+	{
+		// 다른 배열에 적용하거나 값이 잘못된 편집 내역은 적용하지 않음
+		const TArray<FVector2D> Circle = MakeCircle({0., 0.}, 100., 256);
+		const TArray<FVector2D> Bump{{200., 10.}, {200., -10.}};
+
+		TArray<FVector2D> Expanded = Circle;
+		Expanded.Insert(Bump, 250);
+		const FAreaBoundaryDelta Delta = FAreaBoundaryDelta::Make(Circle, Expanded);
+		TestFalse(TEXT("TestCase 4: 더 작은 배열에 적용"), Delta.Apply(MakeCircle({0., 0.}, 100., 16)).IsSet());
+
+		FAreaBoundaryDelta BadRotation = Delta;
+		BadRotation.Rotation = Circle.Num();
+		TestFalse(TEXT("TestCase 4: 범위 밖의 Rotation"), BadRotation.Apply(Circle).IsSet());
+
+		FAreaBoundaryDelta BadIndex = Delta;
+		BadIndex.Splices.Add({.Index = 0, .RemoveCount = 1});
+		TestFalse(TEXT("TestCase 4: 뒤로 가는 Splice"), BadIndex.Apply(Circle).IsSet());
+
+		FAreaBoundaryDelta BadRemoveCount = Delta;
+		BadRemoveCount.Splices[0].RemoveCount = TNumericLimits<int32>::Max();
+		TestFalse(TEXT("TestCase 4: 범위 밖의 RemoveCount"), BadRemoveCount.Apply(Circle).IsSet());
+	}
+
+	return true;
+}
@@ -0,0 +1,60 @@
+#include "TestBoundaryShapes.h"
+#include "Misc/AutomationTest.h"
+#include "PaperUnreal/AreaTracer/AreaContainmentTracker.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AreaContainmentTrackerTest, "PaperUnreal.PaperUnreal.Test.AreaContainmentTrackerTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool AreaContainmentTrackerTest::RunTest(const FString& Parameters)
+{
+	// 공간 인덱스를 사용할 만큼 점이 많은 톱니 모양 다각형
+	using TestBoundaryShapes::MakeGear;
+
+	{
+		const FLoopedSegmentArray2D Boundary{MakeGear({0., 0.}, 100., 256)};
+
+		FAreaContainmentTracker Tracker;
+		int32 MismatchCount = 0;
+		int32 StepCount = 0;
+
+		// 원점을 지나는 직선들을 따라 영역 안팎을 여러 번 드나듦
+		for (int32 Line = 0; Line < 16; Line++)
+		{
+			const double Angle = 2. * UE_PI * Line / 16. + 0.01;
+			const FVector2D Direction{FMath::Cos(Angle), FMath::Sin(Angle)};
+			for (double T = -150.; T <= 150.; T += 1.5)
+			{
+				const FVector2D Location = Direction * T;
+				MismatchCount += Tracker.Update(Boundary, Location) != Boundary.IsInside(Location) ? 1 : 0;
+				StepCount++;
+			}
+		}
+
+		TestEqual(TEXT("TestCase 1: IsInside와 같은 결과"), MismatchCount, 0);
+		TestTrue(TEXT("TestCase 1: 경계 근처에서만 다시 검사"), Tracker.GetFullTestCount() < StepCount / 4);
+	}
+
+	{
+		const FLoopedSegmentArray2D Boundary{MakeGear({0., 0.}, 100., 256)};
+
+		// 꼭짓점을 정확히 지나는 이동
+		FAreaContainmentTracker Tracker;
+		TestTrue(TEXT("TestCase 2: 꼭짓점 통과"), Tracker.Update(Boundary, {0., 0.}));
+		TestFalse(TEXT("TestCase 2: 꼭짓점 통과"), Tracker.Update(Boundary, Boundary.GetPoint(0) * 1.5));
+		TestTrue(TEXT("TestCase 2: 꼭짓점 통과"), Tracker.Update(Boundary, Boundary.GetPoint(1) * 0.5));
+	}
+
+	{
+		const FLoopedSegmentArray2D Before{MakeGear({0., 0.}, 100., 128)};
+		const FLoopedSegmentArray2D After{MakeGear({150., 0.}, 100., 128)};
+
+		FAreaContainmentTracker Tracker;
+		TestTrue(TEXT("TestCase 3: 경계 변경"), Tracker.Update(Before, {-20., 0.}));
+
+		// 점은 움직이지 않았지만 경계가 바뀌어서 밖이 됨
+		Tracker.Invalidate();
+		TestFalse(TEXT("TestCase 3: 경계 변경"), Tracker.Update(After, {-20., 0.}));
+		TestTrue(TEXT("TestCase 3: 경계 변경"), Tracker.Update(After, {100., 0.}));
+	}
+
+	return true;
+}
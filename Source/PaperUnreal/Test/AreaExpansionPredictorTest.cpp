@@ -0,0 +1,123 @@
+#include "Misc/AutomationTest.h"
+#include "PaperUnreal/AreaTracer/AreaExpansionPredictor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AreaExpansionPredictorTest, "PaperUnreal.PaperUnreal.Test.AreaExpansionPredictorTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool AreaExpansionPredictorTest::RunTest(const FString& Parameters)
+{
+	const FLoopedSegmentArray2D Square{{{0., 0.}, {0., 100.}, {100., 100.}, {100., 0.}}};
+	const FSegmentArray2D Path{{{95., 20.}, {150., 20.}, {150., 80.}, {95., 80.}}};
+
+	const auto Expand = [](FLoopedSegmentArray2D Boundary, const FSegmentArray2D& By)
+	{
+		Boundary.Union(By);
+		return Boundary;
+	};
+
+	const FLoopedSegmentArray2D Expanded = Expand(Square, Path);
+	TestNearlyEqual(TEXT("TestCase 0: 확장"), Expanded.CalculateArea(), 13000., 1.);
+
+	{
+		FAreaExpansionPredictor Predictor;
+		Predictor.Reconcile(Square);
+		Predictor.AddPrediction(Path, 1.);
+
+		// 서버가 아직 확장하지 않았으면 예측을 서버의 경계 위에 다시 적용해서 보여줌
+		const FLoopedSegmentArray2D BeforeServer = Predictor.Reconcile(Square);
+		TestNearlyEqual(TEXT("TestCase 1: 서버 확장 전"), BeforeServer.CalculateArea(), 13000., 1.);
+		TestEqual(TEXT("TestCase 1: 서버 확장 전"), Predictor.GetPendingCount(), 1);
+		TestEqual(TEXT("TestCase 1: 서버 확장 전"), Predictor.GetHitCount(), 0);
+
+		// 서버의 트레이서 위치가 약간 달라도 맞은 것으로 봄
+		const FSegmentArray2D ServerPath{{{95., 20.}, {151., 20.}, {151., 80.}, {95., 80.}}};
+		const FLoopedSegmentArray2D AfterServer = Predictor.Reconcile(Expand(Square, ServerPath));
+		TestNearlyEqual(TEXT("TestCase 1: 서버 확장 후"), AfterServer.CalculateArea(), 13060., 1.);
+		TestEqual(TEXT("TestCase 1: 서버 확장 후"), Predictor.GetPendingCount(), 0);
+		TestEqual(TEXT("TestCase 1: 서버 확장 후"), Predictor.GetHitCount(), 1);
+		TestFalse(TEXT("TestCase 1: 서버 확장 후"), Predictor.Expire(2.));
+		TestEqual(TEXT("TestCase 1: 서버 확장 후"), Predictor.GetMissCount(), 0);
+	}
+
+	{
+		FAreaExpansionPredictor Predictor;
+		Predictor.Reconcile(Square);
+		Predictor.AddPrediction(Path, 1.);
+
+		// 다른 플레이어가 왼쪽을 잘라내도 잘린 경계 위에 예측이 적용됨
+		const FLoopedSegmentArray2D Slashed{{{20., 0.}, {20., 100.}, {100., 100.}, {100., 0.}}};
+		const FLoopedSegmentArray2D Rebased = Predictor.Reconcile(Slashed);
+		TestNearlyEqual(TEXT("TestCase 2: 잘린 경계"), Rebased.CalculateArea(), 11000., 1.);
+		TestEqual(TEXT("TestCase 2: 잘린 경계"), Predictor.GetPendingCount(), 1);
+
+		// 확장과 함께 다른 플레이어가 잘라낸 경계가 도착해도 맞은 것으로 봄
+		FAreaExpansionPredictor SlashedPredictor;
+		SlashedPredictor.Reconcile(Square);
+		SlashedPredictor.AddPrediction(Path, 1.);
+		const FLoopedSegmentArray2D SlashedAndExpanded = SlashedPredictor.Reconcile(Expand(Slashed, Path));
+		TestEqual(TEXT("TestCase 2: 잘리면서 확장된 경계"), SlashedPredictor.GetHitCount(), 1);
+		TestEqual(TEXT("TestCase 2: 잘리면서 확장된 경계"), SlashedPredictor.GetPendingCount(), 0);
+		TestNearlyEqual(TEXT("TestCase 2: 잘리면서 확장된 경계"), SlashedAndExpanded.CalculateArea(), 11000., 1.);
+
+		// 서버가 확장하지 않은 채로 만료되면 틀린 것
+		TestFalse(TEXT("TestCase 2: 만료"), Predictor.Expire(0.5));
+		TestTrue(TEXT("TestCase 2: 만료"), Predictor.Expire(1.5));
+		TestEqual(TEXT("TestCase 2: 만료"), Predictor.GetMissCount(), 1);
+		TestEqual(TEXT("TestCase 2: 만료"), Predictor.GetPendingCount(), 0);
+		TestNearlyEqual(TEXT("TestCase 2: 만료"), Predictor.GetAuthoritative().CalculateArea(), 8000., 1.);
+	}
+
+	{
+		// 연속된 예측은 순서대로 맞춰봄
+		const FSegmentArray2D SecondPath{{{20., 95.}, {20., 150.}, {80., 150.}, {80., 95.}}};
+		const FLoopedSegmentArray2D TwiceExpanded = Expand(Expanded, SecondPath);
+
+		FAreaExpansionPredictor Predictor;
+		Predictor.Reconcile(Square);
+		Predictor.AddPrediction(Path, 1.);
+		Predictor.AddPrediction(SecondPath, 2.);
+
+		const FLoopedSegmentArray2D First = Predictor.Reconcile(Expanded);
+		TestEqual(TEXT("TestCase 3: 연속된 예측"), Predictor.GetHitCount(), 1);
+		TestNearlyEqual(TEXT("TestCase 3: 연속된 예측"), First.CalculateArea(), 16000., 1.);
+
+		Predictor.Reconcile(TwiceExpanded);
+		TestEqual(TEXT("TestCase 3: 연속된 예측"), Predictor.GetHitCount(), 2);
+		TestEqual(TEXT("TestCase 3: 연속된 예측"), Predictor.GetPendingCount(), 0);
+	}
+
+	{
+		// 서버가 두 번째 확장만 적용한 것처럼 보여도 첫 번째 확장이 맞지 않았으면 순서대로 기다림
+		const FSegmentArray2D SecondPath{{{20., 95.}, {20., 150.}, {80., 150.}, {80., 95.}}};
+
+		FAreaExpansionPredictor Predictor;
+		Predictor.Reconcile(Square);
+		Predictor.AddPrediction(Path, 1.);
+		Predictor.AddPrediction(SecondPath, 2.);
+
+		const FLoopedSegmentArray2D Displayed = Predictor.Reconcile(Expand(Square, SecondPath));
+		TestEqual(TEXT("TestCase 4: 순서대로 맞춰봄"), Predictor.GetHitCount(), 0);
+		TestEqual(TEXT("TestCase 4: 순서대로 맞춰봄"), Predictor.GetPendingCount(), 2);
+		TestNearlyEqual(TEXT("TestCase 4: 순서대로 맞춰봄"), Displayed.CalculateArea(), 16000., 1.);
+	}
+
+	{
+		FAreaExpansionPredictor Predictor;
+		Predictor.Reconcile(Square);
+		Predictor.AddPrediction(Path, 1.);
+
+		// 다른 플레이어가 오른쪽을 잘라내서 Path의 끝이 서버의 경계에서 벗어나면 Union이 실패해서 늘어나는 넓이가 0이지만 맞은 것이 아님
+		const FLoopedSegmentArray2D CutRight{{{0., 0.}, {0., 100.}, {90., 100.}, {90., 0.}}};
+		const FLoopedSegmentArray2D Displayed = Predictor.Reconcile(CutRight);
+		TestEqual(TEXT("TestCase 5: 끝이 경계에서 벗어난 Path"), Predictor.GetHitCount(), 0);
+		TestEqual(TEXT("TestCase 5: 끝이 경계에서 벗어난 Path"), Predictor.GetPendingCount(), 1);
+		TestNearlyEqual(TEXT("TestCase 5: 끝이 경계에서 벗어난 Path"), Displayed.CalculateArea(), 9000., 1.);
+
+		// 서버가 잘린 경계에서 시작하는 트레이서로 확장하면 Path의 끝이 경계 안에 있어도 맞은 것으로 봄
+		const FSegmentArray2D ServerPath{{{90., 20.}, {150., 20.}, {150., 80.}, {90., 80.}}};
+		Predictor.Reconcile(Expand(CutRight, ServerPath));
+		TestEqual(TEXT("TestCase 5: 끝이 경계에서 벗어난 Path"), Predictor.GetHitCount(), 1);
+		TestEqual(TEXT("TestCase 5: 끝이 경계에서 벗어난 Path"), Predictor.GetPendingCount(), 0);
+	}
+
+	return true;
+}
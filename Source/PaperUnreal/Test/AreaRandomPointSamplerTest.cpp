@@ -0,0 +1,73 @@
+﻿#include "Misc/AutomationTest.h"
+#include "PaperUnreal/AreaTracer/AreaRandomPointSampler.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AreaRandomPointSamplerTest, "PaperUnreal.PaperUnreal.Test.AreaRandomPointSamplerTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool AreaRandomPointSamplerTest::RunTest(const FString& Parameters)
+{
+	{
+		const FAreaRandomPointSampler Sampler{FLoopedSegmentArray2D{{{0.f, 0.f}, {10.f, 0.f}}}};
+		TestFalse(TEXT("TestCase 1: 넓이가 없는 영역"), Sampler.IsValid());
+	}
+
+	{
+		// ㄴ자 모양, 아래쪽 막대(넓이 50)가 위쪽 막대(넓이 25)보다 두 배 자주 뽑혀야 함
+		const FLoopedSegmentArray2D Boundary{
+			{
+				{0.f, 0.f},
+				{10.f, 0.f},
+				{10.f, 5.f},
+				{5.f, 5.f},
+				{5.f, 10.f},
+				{0.f, 10.f},
+			}
+		};
+
+		const FAreaRandomPointSampler Sampler{Boundary};
+		RETURN_IF_FALSE(TestTrue(TEXT("TestCase 2: 균일한 점"), Sampler.IsValid()));
+		TestNearlyEqual(TEXT("TestCase 2: 균일한 점"), Sampler.GetArea(), 75.);
+
+		constexpr int32 SampleCount = 3000;
+		int32 LowerCount = 0;
+		int32 OutsideCount = 0;
+		for (int32 i = 0; i < SampleCount; i++)
+		{
+			const FVector2D Point = Sampler.Sample();
+			OutsideCount += Boundary.IsInside(Point) ? 0 : 1;
+			LowerCount += Point.Y < 5. ? 1 : 0;
+		}
+
+		TestEqual(TEXT("TestCase 2: 영역 밖의 점"), OutsideCount, 0);
+		TestTrue(TEXT("TestCase 2: 넓이에 비례하는 분포"), FMath::Abs(static_cast<double>(LowerCount) / SampleCount - 2. / 3.) < 0.05);
+	}
+
+	{
+		const FLoopedSegmentArray2D Boundary{
+			{
+				{0.f, 0.f},
+				{10.f, 0.f},
+				{10.f, 5.f},
+				{5.f, 5.f},
+				{5.f, 10.f},
+				{0.f, 10.f},
+			}
+		};
+
+		const FAreaRandomPointSampler Sampler{Boundary};
+
+		int32 TooCloseCount = 0;
+		for (int32 i = 0; i < 500; i++)
+		{
+			const FVector2D Point = Sampler.Sample(Boundary, 1., 64);
+			const FVector2D Closest = Boundary.FindClosestPointTo(Point).Location(Boundary);
+			TooCloseCount += Boundary.IsInside(Point) && FVector2D::Distance(Point, Closest) >= 1. ? 0 : 1;
+		}
+
+		TestEqual(TEXT("TestCase 3: 경계에서 떨어진 점"), TooCloseCount, 0);
+
+		// 영역 어디에도 경계에서 100만큼 떨어진 점은 없으므로 영역 안의 점 중 아무거나라도 반환해야 함
+		TestTrue(TEXT("TestCase 3: 조건을 만족하는 점이 없음"), Boundary.IsInside(Sampler.Sample(Boundary, 100.)));
+	}
+
+	return true;
+}
@@ -0,0 +1,117 @@
+#include "TestBoundaryShapes.h"
+#include "Misc/AutomationTest.h"
+#include "PaperUnreal/AreaTracer/AreaSpawnLocationCalculator.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AreaSpawnLocationCalculatorTest, "PaperUnreal.PaperUnreal.Test.AreaSpawnLocationCalculatorTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool AreaSpawnLocationCalculatorTest::RunTest(const FString& Parameters)
+{
+	const auto MakeBox = [](const FVector2D& Min, const FVector2D& Max)
+	{
+		return FLoopedSegmentArray2D{{Min, {Min.X, Max.Y}, Max, {Max.X, Min.Y}}};
+	};
+
+	{
+		FAreaSpawnLocationCalculator Calculator;
+		Calculator.Configure({{0., 0.}, {1000., 1000.}}, 100.f);
+		TestEqual(TEXT("TestCase 1: 빈 월드"), Calculator.GetEmptyCellCount(), 100);
+
+		// 칸 (2, 2) ~ (4, 4)에 걸친 영역
+		Calculator.SetArea(0, MakeBox({250., 250.}, {450., 450.}));
+		TestEqual(TEXT("TestCase 1: 영역 추가"), Calculator.GetEmptyCellCount(), 91);
+		TestFalse(TEXT("TestCase 1: 영역 추가"), Calculator.IsEmptyAt({350., 350.}));
+		TestFalse(TEXT("TestCase 1: 영역 추가"), Calculator.IsEmptyAt({210., 210.}));
+		TestTrue(TEXT("TestCase 1: 영역 추가"), Calculator.IsEmptyAt({550., 350.}));
+
+		// 영역을 옮기면 전에 차지하던 칸이 비워짐
+		Calculator.SetArea(0, MakeBox({610., 610.}, {690., 690.}));
+		TestEqual(TEXT("TestCase 1: 영역 이동"), Calculator.GetEmptyCellCount(), 99);
+		TestTrue(TEXT("TestCase 1: 영역 이동"), Calculator.IsEmptyAt({350., 350.}));
+		TestFalse(TEXT("TestCase 1: 영역 이동"), Calculator.IsEmptyAt({650., 650.}));
+
+		// 겹치는 영역 하나를 지워도 다른 영역이 차지하는 칸은 그대로 차 있음
+		Calculator.SetArea(1, MakeBox({550., 550.}, {750., 650.}));
+		TestEqual(TEXT("TestCase 1: 겹치는 영역"), Calculator.GetEmptyCellCount(), 94);
+		Calculator.RemoveArea(1);
+		TestEqual(TEXT("TestCase 1: 겹치는 영역"), Calculator.GetEmptyCellCount(), 99);
+		TestFalse(TEXT("TestCase 1: 겹치는 영역"), Calculator.IsEmptyAt({650., 650.}));
+		Calculator.RemoveArea(0);
+		TestEqual(TEXT("TestCase 1: 겹치는 영역"), Calculator.GetEmptyCellCount(), 100);
+
+		// 월드를 벗어나는 영역은 월드 안의 칸만 차지함
+		Calculator.SetArea(2, MakeBox({-500., -500.}, {150., 2000.}));
+		TestEqual(TEXT("TestCase 1: 월드 밖의 영역"), Calculator.GetEmptyCellCount(), 80);
+	}
+
+	{
+		FAreaSpawnLocationCalculator Calculator;
+		Calculator.Configure({{0., 0.}, {1050., 520.}}, 100.f);
+		TestEqual(TEXT("TestCase 2: 정사각형이 아닌 월드"), Calculator.GetEmptyCellCount(), 50);
+
+		// 가운데 한 줄만 남기고 채움
+		Calculator.SetArea(0, MakeBox({0., 0.}, {1050., 205.}));
+		Calculator.SetArea(1, MakeBox({0., 315.}, {1050., 520.}));
+		TestEqual(TEXT("TestCase 2: 정사각형이 아닌 월드"), Calculator.GetEmptyCellCount(), 10);
+
+		bool bAllInRow = true;
+		for (int32 i = 0; i < 100; i++)
+		{
+			const TOptional<FBox2D> Cell = Calculator.GetRandomEmptyCell();
+			bAllInRow &= Cell && FMath::IsNearlyEqual(Cell->GetCenter().Y, 260.) && Cell->Min.X >= 25. && Cell->Max.X <= 1025.;
+		}
+		TestTrue(TEXT("TestCase 2: 정사각형이 아닌 월드"), bAllInRow);
+
+		Calculator.SetArea(2, MakeBox({0., 0.}, {1050., 520.}));
+		TestFalse(TEXT("TestCase 2: 빈 칸 없음"), Calculator.GetRandomEmptyCell().IsSet());
+	}
+
+	{
+		// 원 모양 영역이 차지하는 칸이 실제로 원과 겹치는 칸과 같은지 확인
+		const FLoopedSegmentArray2D Circle{TestBoundaryShapes::MakeCircle({512., 487.}, 333., 64)};
+
+		FAreaSpawnLocationCalculator Calculator;
+		Calculator.Configure({{0., 0.}, {1000., 1000.}}, 50.f);
+		Calculator.SetArea(0, Circle);
+
+		int32 MissingCount = 0;
+		int32 ExtraCount = 0;
+		for (int32 Y = 0; Y < 20; Y++)
+		{
+			for (int32 X = 0; X < 20; X++)
+			{
+				const FVector2D Min{X * 50., Y * 50.};
+				const FVector2D Max = Min + FVector2D{50., 50.};
+
+				// 칸 안쪽의 점들로 겹치는지 확인
+				bool bSampledInside = false;
+				for (int32 SY = 0; SY <= 10 && !bSampledInside; SY++)
+				{
+					for (int32 SX = 0; SX <= 10 && !bSampledInside; SX++)
+					{
+						bSampledInside = Circle.IsInside(Min + FVector2D{0.1 + SX * 4.98, 0.1 + SY * 4.98});
+					}
+				}
+
+				const bool bOccupied = !Calculator.IsEmptyAt((Min + Max) / 2.);
+				MissingCount += bSampledInside && !bOccupied ? 1 : 0;
+
+				// 점 샘플로 못 찾았는데 차지한 칸은 경계가 칸 근처를 지나가야 함
+				if (bOccupied && !bSampledInside)
+				{
+					const FRawSegment2D Diagonal{Min, Max};
+					const FRawSegment2D OtherDiagonal{{Min.X, Max.Y}, {Max.X, Min.Y}};
+					ExtraCount += Circle.IsNear(Diagonal, 1.) || Circle.IsNear(OtherDiagonal, 1.) || Circle.IsNear({Min, {Min.X, Max.Y}}, 1.)
+						|| Circle.IsNear({Min, {Max.X, Min.Y}}, 1.) || Circle.IsNear({Max, {Min.X, Max.Y}}, 1.) || Circle.IsNear({Max, {Max.X, Min.Y}}, 1.) ? 0 : 1;
+				}
+			}
+		}
+
+		TestEqual(TEXT("TestCase 3: 원 모양 영역"), MissingCount, 0);
+		TestEqual(TEXT("TestCase 3: 원 모양 영역"), ExtraCount, 0);
+
+		Calculator.RemoveArea(0);
+		TestEqual(TEXT("TestCase 3: 원 모양 영역"), Calculator.GetEmptyCellCount(), 400);
+	}
+
+	return true;
+}
@@ -0,0 +1,61 @@
+#include "Misc/AutomationTest.h"
+#include "PaperUnreal/AreaTracer/MovementSubstepper.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(MovementSubstepperTest, "PaperUnreal.PaperUnreal.Test.MovementSubstepperTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool MovementSubstepperTest::RunTest(const FString& Parameters)
+{
+	// 반지름 100인 원을 따라 일정한 속력으로 도는 움직임을 주어진 틱 간격으로 넣고 나온 위치들을 모음
+	const auto RunCircle = [](float Interval, float DeltaTime, double Duration)
+	{
+		FMovementSubstepper Substepper;
+		Substepper.SetInterval(Interval);
+
+		TArray<FVector2D> Ret;
+		for (double Time = 0.; Time <= Duration + UE_KINDA_SMALL_NUMBER; Time += DeltaTime)
+		{
+			const FVector2D Location = FVector2D{FMath::Cos(Time), FMath::Sin(Time)} * 100.;
+			const FVector2D Velocity = FVector2D{-FMath::Sin(Time), FMath::Cos(Time)} * 100.;
+			Substepper.Tick(Location, Velocity, DeltaTime, [&](const FVector2D& Each) { Ret.Add(Each); });
+		}
+		return Ret;
+	};
+
+	{
+		const TArray<FVector2D> Locations = RunCircle(0.f, 0.1f, 1.);
+		TestEqual(TEXT("TestCase 1: 서브스텝 없음"), Locations.Num(), 11);
+	}
+
+	{
+		// 10Hz로 넣어도 중간 위치들이 원 위에 있어야 함
+		const TArray<FVector2D> Locations = RunCircle(1.f / 60.f, 0.1f, 1.);
+		TestTrue(TEXT("TestCase 2: 중간 위치 복원"), Locations.Num() >= 60);
+
+		double MaxError = 0.;
+		for (const FVector2D& Each : Locations)
+		{
+			MaxError = FMath::Max(MaxError, FMath::Abs(Each.Length() - 100.));
+		}
+		TestTrue(TEXT("TestCase 2: 중간 위치 복원"), MaxError < 0.1);
+	}
+
+	{
+		// 틱 레이트가 달라도 고정 간격 위치들은 같은 시각에서 뽑히므로 거의 같은 곳에 있어야 함
+		const TArray<FVector2D> Slow = RunCircle(0.05f, 0.25f, 2.);
+		const TArray<FVector2D> Fast = RunCircle(0.05f, 0.125f, 2.);
+
+		int32 FarCount = 0;
+		for (const FVector2D& Each : Slow)
+		{
+			double Closest = TNumericLimits<double>::Max();
+			for (const FVector2D& Other : Fast)
+			{
+				Closest = FMath::Min(Closest, FVector2D::Distance(Each, Other));
+			}
+			FarCount += Closest > 0.5 ? 1 : 0;
+		}
+		TestEqual(TEXT("TestCase 3: 틱 레이트와 무관한 위치"), FarCount, 0);
+	}
+
+	return true;
+}
@@ -0,0 +1,121 @@
+#include "TestBoundaryShapes.h"
+#include "Misc/AutomationTest.h"
+#include "PaperUnreal/AreaTracer/QuantizedPointCodec.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(QuantizedPointCodecTest, "PaperUnreal.PaperUnreal.Test.QuantizedPointCodecTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool QuantizedPointCodecTest::RunTest(const FString& Parameters)
+{
+	const auto RoundTrip = [&](const TArray<FVector2D>& Points, TArray<FVector2D>& OutPoints)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer{Bytes};
+		TArray<FVector2D> ToWrite = Points;
+		FQuantizedPointCodec::SerializePoints(Writer, ToWrite);
+
+		FMemoryReader Reader{Bytes};
+		FQuantizedPointCodec::SerializePoints(Reader, OutPoints);
+		TestFalse(TEXT("읽기 오류 없음"), Reader.IsError());
+		return Bytes.Num();
+	};
+
+	const auto MaxError = [](const TArray<FVector2D>& Left, const TArray<FVector2D>& Right)
+	{
+		double Ret = 0.;
+		for (int32 i = 0; i < Left.Num(); i++)
+		{
+			Ret = FMath::Max(Ret, FMath::Max(FMath::Abs(Left[i].X - Right[i].X), FMath::Abs(Left[i].Y - Right[i].Y)));
+		}
+		return Ret;
+	};
+
+	{
+		const int64 Values[]{0, 1, -1, 63, -64, 64, 123456789, -123456789, MAX_int64, MIN_int64};
+		for (int64 Each : Values)
+		{
+			TestEqual(TEXT("TestCase 1: ZigZag"), FQuantizedPointCodec::ZigZagDecode(FQuantizedPointCodec::ZigZagEncode(Each)), Each);
+		}
+		TestEqual(TEXT("TestCase 1: ZigZag"), FQuantizedPointCodec::ZigZagEncode(-1), static_cast<uint64>(1));
+		TestEqual(TEXT("TestCase 1: ZigZag"), FQuantizedPointCodec::ZigZagEncode(1), static_cast<uint64>(2));
+
+		TArray<FVector2D> Empty;
+		TArray<FVector2D> Read{{1., 1.}};
+		TestEqual(TEXT("TestCase 1: 빈 배열"), RoundTrip(Empty, Read), 1);
+		TestEqual(TEXT("TestCase 1: 빈 배열"), Read.Num(), 0);
+
+		// 격자에서 멀리 떨어진 점들끼리의 차이도 그대로 보낼 수 있음
+		const TArray<FVector2D> Far{{-100000., 100000.}, {100000., -100000.}, {0.03, -0.03}};
+		RoundTrip(Far, Read);
+		TestEqual(TEXT("TestCase 1: 먼 점들"), Read.Num(), 3);
+		TestTrue(TEXT("TestCase 1: 먼 점들"), MaxError(Far, Read) <= 0.5 / FQuantizedSegmentArray2D::UnitsPerCentimeter);
+	}
+
+	{
+		// 잘못된 데이터를 읽으면 오류를 내고 멈춤
+		TArray<uint8> Truncated;
+		FMemoryWriter Writer{Truncated};
+		uint64 Count = 100;
+		FQuantizedPointCodec::SerializeVarint(Writer, Count);
+
+		TArray<FVector2D> Read;
+		FMemoryReader Reader{Truncated};
+		FQuantizedPointCodec::SerializePoints(Reader, Read);
+		TestTrue(TEXT("TestCase 2: 잘린 데이터"), Reader.IsError());
+
+		TArray<uint8> TooMany;
+		FMemoryWriter TooManyWriter{TooMany};
+		uint64 HugeCount = FQuantizedPointCodec::MaxPointCount + 1;
+		FQuantizedPointCodec::SerializeVarint(TooManyWriter, HugeCount);
+
+		FMemoryReader TooManyReader{TooMany};
+		FQuantizedPointCodec::SerializePoints(TooManyReader, Read);
+		TestTrue(TEXT("TestCase 2: 너무 많은 점"), TooManyReader.IsError());
+	}
+
+	{
+		// 게임에서 흔한 크기의 영역 경계와 트레이서 경로로 점 하나당 바이트 수를 비교
+		const TArray<FVector2D> Boundary = TestBoundaryShapes::MakeWavyCircle({1234.5, -876.25}, 1500., 40., 17, 2000);
+
+		TArray<FVector2D> Path{{512.3, 256.7}};
+		for (int32 i = 1; i < 500; i++)
+		{
+			const double Heading = 0.02 * i + 0.3 * FMath::Sin(0.1 * i);
+			Path.Add(Path.Last() + FVector2D{FMath::Cos(Heading), FMath::Sin(Heading)} * 20.);
+		}
+
+		const auto TestBytesPerPoint = [&](const TCHAR* Name, const TArray<FVector2D>& Points)
+		{
+			TArray<FVector2D> Read;
+			const int32 ByteCount = RoundTrip(Points, Read);
+			const double BytesPerPoint = static_cast<double>(ByteCount) / Points.Num();
+			AddInfo(FString::Printf(TEXT("%s: %d bytes per point before, %.2f bytes per point after"),
+				Name, static_cast<int32>(sizeof(FVector2D)), BytesPerPoint));
+
+			TestEqual(TEXT("TestCase 3: 점 하나당 바이트 수"), Read.Num(), Points.Num());
+			TestTrue(TEXT("TestCase 3: 점 하나당 바이트 수"), MaxError(Points, Read) <= 0.5 / FQuantizedSegmentArray2D::UnitsPerCentimeter);
+			TestTrue(TEXT("TestCase 3: 점 하나당 바이트 수"), BytesPerPoint <= 6.);
+		};
+
+		TestBytesPerPoint(TEXT("Boundary"), Boundary);
+		TestBytesPerPoint(TEXT("Path"), Path);
+	}
+
+	{
+		// 격자 범위를 벗어나는 점도 FQuantizedSegmentArray2D와 같은 정수 좌표로 보냄
+		const TArray<FVector2D> Points{{0.03, -0.03}, {12345.678, -9876.543}, {1e9, -1e9}, {-1e12, 5.}};
+		TArray<FVector2D> Read;
+		RoundTrip(Points, Read);
+
+		bool bAllEqual = Read.Num() == Points.Num();
+		for (int32 i = 0; bAllEqual && i < Points.Num(); i++)
+		{
+			bAllEqual = FQuantizedSegmentArray2D::Quantize(Read[i]) == FQuantizedSegmentArray2D::Quantize(Points[i])
+				&& Read[i] == FQuantizedSegmentArray2D::Dequantize(FQuantizedSegmentArray2D::Quantize(Points[i]));
+		}
+		TestTrue(TEXT("TestCase 4: FQuantizedSegmentArray2D와 같은 격자"), bAllEqual);
+	}
+
+	return true;
+}
@@ -0,0 +1,63 @@
+﻿#include "Misc/AutomationTest.h"
+#include "PaperUnreal/AreaTracer/QuantizedSegmentArray.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(QuantizedSegmentArrayTest, "PaperUnreal.PaperUnreal.Test.QuantizedSegmentArrayTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool QuantizedSegmentArrayTest::RunTest(const FString& Parameters)
+{
+	{
+		const FIntPoint Quantized = FQuantizedLoopedSegmentArray2D::Quantize({1.0625, -2.5});
+		TestEqual(TEXT("TestCase 1: Quantize"), Quantized, FIntPoint{17, -40});
+		TestEqual(TEXT("TestCase 1: Dequantize"), FQuantizedLoopedSegmentArray2D::Dequantize(Quantized), FVector2D{1.0625, -2.5});
+	}
+
+	{
+		const FLoopedSegmentArray2D SegmentArray{
+			{
+				{0.f, 0.f},
+				{10.f, 0.f},
+				{10.f, 10.f},
+				{5.f, 15.f},
+				{0.f, 10.f},
+			}
+		};
+
+		const FQuantizedLoopedSegmentArray2D Quantized{SegmentArray};
+		TestEqual(TEXT("TestCase 2: 넓이"), Quantized.CalculateSignedDoubleArea(), static_cast<int64>(2 * 125 * 16 * 16));
+		TestEqual(TEXT("TestCase 2: 넓이"), Quantized.CalculateArea(), 125.f);
+		TestEqual(TEXT("TestCase 2: 방향"), Quantized.IsClockwise(), SegmentArray.IsClockwise());
+		TestEqual(TEXT("TestCase 2: FVector2D로 변환"), Quantized.ToSegmentArray().GetPoints(), SegmentArray.GetPoints());
+
+		const TArray<FVector2D> Points
+		{
+			{5.f, 5.f},
+			{0.f, 0.f},
+			{5.f, 0.f},
+			{10.f, 5.f},
+			{7.5f, 12.5f},
+			{-1.f, 10.f},
+			{-1.f, 0.f},
+			{11.f, 10.f},
+			{5.f, 15.0625f},
+			{5.f, 14.9375f},
+		};
+
+		const TArray<bool> Expected{true, true, true, true, true, false, false, false, false, true};
+
+		for (int32 i = 0; i < Points.Num(); i++)
+		{
+			TestEqual(TEXT("TestCase 2: 경계 위의 점과 꼭짓점 높이의 점"), Quantized.IsInside(Points[i]), Expected[i]);
+		}
+	}
+
+	{
+		const FQuantizedSegmentArray2D Quantized{TArray<FIntPoint>{{0, 0}, {160, 0}, {160, 160}}};
+
+		TestTrue(TEXT("TestCase 3: 끝점이 닿는 교차"), Quantized.SegmentIntersects(0, {80, 0}, {80, 80}));
+		TestTrue(TEXT("TestCase 3: 일직선으로 겹치는 교차"), Quantized.SegmentIntersects(0, {150, 0}, {170, 0}));
+		TestFalse(TEXT("TestCase 3: 평행하지만 1/16cm 떨어진 Segment"), Quantized.SegmentIntersects(0, {0, 1}, {160, 1}));
+		TestEqual(TEXT("TestCase 3: 꼭짓점을 지나는 Segment"), Quantized.FindAllIntersectingSegments({150, 10}, {170, -10}), TArray<int32>{0, 1});
+	}
+
+	return true;
+}
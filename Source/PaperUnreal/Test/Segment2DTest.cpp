@@ -8,5 +8,38 @@ bool Segment2DTest::RunTest(const FString& Parameters)
 	const FSegment2D Segment{{1.f, 1.f}, {2.f, 1.f}};
 	const FSegment2D Perp = Segment.Perp({1.5f, 2.f});
 	TestEqual(TEXT(""), Perp, {{1.5f, 1.f}, {1.5f, 2.f}});
+
+	{
+		const FRawSegment2D RawSegment{{1.f, 1.f}, {3.f, 1.f}};
+		TestEqual(TEXT("RawSegment 정사영"), RawSegment.ProjectUnitRange({1.5f, 2.f}), 0.25);
+		TestEqual(TEXT("RawSegment 정사영 범위 밖"), RawSegment.ProjectUnitRange({5.f, 0.f}), 1.);
+		TestEqual(TEXT("RawSegment 거리"), RawSegment.SquaredDistanceTo({0.f, 0.f}), 2.);
+		TestTrue(TEXT("RawSegment 방향"), RawSegment.Orientation({2.f, 2.f}) > 0. && RawSegment.Orientation({2.f, 0.f}) < 0.);
+		TestEqual(TEXT("RawSegment 직선 위"), RawSegment.Orientation({5.f, 1.f}), 0.);
+
+		const FRawSegment2D Crossing{{2.5f, 0.f}, {2.5f, 4.f}};
+		const TOptional<float> Alpha = RawSegment.Intersects(Crossing);
+		TestTrue(TEXT("RawSegment 교차"), Alpha.IsSet() && FMath::IsNearlyEqual(*Alpha, 0.75f));
+		TestTrue(TEXT("RawSegment 교차 FSegment2D와 같음"), Alpha == RawSegment.ToSegment().Intersects(Crossing.ToSegment()));
+		TestFalse(TEXT("RawSegment 평행"), RawSegment.Intersects({{1.f, 2.f}, {3.f, 2.f}}).IsSet());
+		TestFalse(TEXT("RawSegment 교차하지 않음"), RawSegment.Intersects({{4.f, 0.f}, {4.f, 4.f}}).IsSet());
+
+		const FRawSegment2D Degenerate{{1.f, 1.f}, {1.f, 1.f}};
+		TestEqual(TEXT("RawSegment 길이 0"), Degenerate.ProjectUnitRange({2.f, 2.f}), 0.);
+	}
+
+	{
+		const FLoopedSegmentArray2D SegmentArray{{{0.f, 0.f}, {2.f, 0.f}, {2.f, 2.f}}};
+
+		int32 Index = 0;
+		for (const FRawSegment2D& Each : SegmentArray.RawSegments())
+		{
+			TestTrue(TEXT("RawSegments 순회"), Each.ToSegment() == SegmentArray[Index]);
+			Index++;
+		}
+		TestEqual(TEXT("RawSegments 개수"), Index, SegmentArray.SegmentCount());
+		TestEqual(TEXT("GetRawSegment 마지막"), SegmentArray.GetRawSegment(-1).End, FVector2D{0.f, 0.f});
+	}
+
 	return true;
 }
@@ -0,0 +1,165 @@
+﻿#include "TestBoundaryShapes.h"
+#include "Misc/AutomationTest.h"
+#include "PaperUnreal/AreaTracer/SegmentArrayKernels.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(SegmentArrayKernelsTest, "PaperUnreal.PaperUnreal.Test.SegmentArrayKernelsTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool SegmentArrayKernelsTest::RunTest(const FString& Parameters)
+{
+	using TestBoundaryShapes::MakeGear;
+
+	// SIMD 레인(AVX2는 4, SSE2는 2)에 딱 맞지 않게 남는 Segment와 점이 생기도록 점 개수를 고름
+	const TArray<int32> PointCounts{17, 18, 19, 22, 23};
+
+	/**
+	 * 위쪽 변이 톱니와 수평한 변이 섞인 계단 모양이고 아래쪽 변은 y = 0인 다각형
+	 * 꼭짓점이나 수평한 변과 같은 높이의 점을 만들기 쉽도록 모든 꼭짓점이 정수 좌표에 있음
+	 */
+	const auto MakeStaircase = [](int32 PointCount)
+	{
+		TArray<FVector2D> Ret;
+		for (int32 i = 0; i < PointCount - 2; i++)
+		{
+			Ret.Emplace(2. * i, i % 3 == 2 ? 12. : 10.);
+		}
+		Ret.Emplace(2. * (PointCount - 3), 0.);
+		Ret.Emplace(0., 0.);
+		return Ret;
+	};
+
+	// TSegmentArray2D가 Segment가 적을 때 사용하는 스칼라 IsInside와 같은 계산
+	const auto ScalarIsInside = [](const TArray<FVector2D>& Points, const FVector2D& Point)
+	{
+		bool bInside = false;
+		for (int32 i = 0; i < Points.Num(); i++)
+		{
+			const FVector2D& Start = Points[i];
+			const FVector2D& End = Points[(i + 1) % Points.Num()];
+			if (Point.Y < FMath::Min(Start.Y, End.Y) - UE_KINDA_SMALL_NUMBER || Point.Y > FMath::Max(Start.Y, End.Y) + UE_KINDA_SMALL_NUMBER)
+			{
+				continue;
+			}
+
+			const FVector2D Edge = End - Start;
+			const double Cross = FVector2D::CrossProduct(Edge, Point - Start);
+			if (Cross * Cross <= UE_KINDA_SMALL_NUMBER * UE_KINDA_SMALL_NUMBER * Edge.SquaredLength()
+				&& Point.X >= FMath::Min(Start.X, End.X) - UE_KINDA_SMALL_NUMBER
+				&& Point.X <= FMath::Max(Start.X, End.X) + UE_KINDA_SMALL_NUMBER)
+			{
+				return true;
+			}
+
+			if ((Start.Y > Point.Y) != (End.Y > Point.Y) && (Edge.Y > 0. ? Cross > 0. : Cross < 0.))
+			{
+				bInside = !bInside;
+			}
+		}
+		return bInside;
+	};
+
+	const auto ScalarSquaredDistance = [](const FVector2D& Start, const FVector2D& End, const FVector2D& Point)
+	{
+		const FVector2D Dir = End - Start;
+		const double LengthSquared = Dir.SquaredLength();
+		const double T = LengthSquared > 0. ? FMath::Clamp(FVector2D::DotProduct(Point - Start, Dir) / LengthSquared, 0., 1.) : 0.;
+		return FVector2D::DistSquared(Start + Dir * T, Point);
+	};
+
+	for (int32 PointCount : PointCounts)
+	{
+		for (const TArray<FVector2D>& Points : {MakeStaircase(PointCount), MakeGear({3., -7.}, 100., PointCount)})
+		{
+			FSegmentArraySoA SoA;
+			SoA.Build(Points);
+
+			double DoubleArea = 0.;
+			for (int32 i = 0; i < Points.Num(); i++)
+			{
+				DoubleArea += FVector2D::CrossProduct(Points[i], Points[(i + 1) % Points.Num()]);
+			}
+			TestNearlyEqual(TEXT("TestCase 1: 넓이"), SegmentArrayKernels::CalculateSignedDoubleArea(SoA), DoubleArea);
+			TestEqual(TEXT("TestCase 2: Bounding Box"), SegmentArrayKernels::CalculateBoundingBox(SoA), FBox2D{Points});
+		}
+	}
+
+	for (int32 PointCount : PointCounts)
+	{
+		const TArray<FVector2D> Points = MakeStaircase(PointCount);
+		FSegmentArraySoA SoA;
+		SoA.Build(Points);
+
+		// 모든 꼭짓점의 높이에서 꼭짓점 위, 꼭짓점 양 옆, 다각형 밖의 점과 변의 중점을 검사
+		TArray<FVector2D> QueryPoints;
+		for (int32 i = 0; i < Points.Num(); i++)
+		{
+			const FVector2D& Each = Points[i];
+			for (double OffsetX : {-1.5, -0.5, -UE_KINDA_SMALL_NUMBER * 0.5, 0., UE_KINDA_SMALL_NUMBER * 0.5, 0.5, 1.5})
+			{
+				QueryPoints.Emplace(Each.X + OffsetX, Each.Y);
+			}
+			QueryPoints.Emplace(-1., Each.Y);
+			QueryPoints.Emplace(2. * PointCount, Each.Y);
+			QueryPoints.Add((Each + Points[(i + 1) % Points.Num()]) * 0.5);
+		}
+
+		for (const FVector2D& Each : QueryPoints)
+		{
+			TestEqual(TEXT("TestCase 3: 꼭짓점이나 변과 같은 높이의 점"), SegmentArrayKernels::IsInside(SoA, Each), ScalarIsInside(Points, Each));
+		}
+
+		TestTrue(TEXT("TestCase 3: 안쪽의 점"), SegmentArrayKernels::IsInside(SoA, {1., 5.}));
+		TestFalse(TEXT("TestCase 3: 바깥쪽의 점"), SegmentArrayKernels::IsInside(SoA, {1., 11.}));
+	}
+
+	for (int32 PointCount : PointCounts)
+	{
+		for (const TArray<FVector2D>& Points : {MakeStaircase(PointCount), MakeGear({3., -7.}, 100., PointCount)})
+		{
+			FSegmentArraySoA SoA;
+			SoA.Build(Points);
+
+			for (bool bLoop : {true, false})
+			{
+				const int32 SegmentCount = bLoop ? Points.Num() : Points.Num() - 1;
+
+				TArray<FVector2D> QueryPoints{{0., 0.}, {-150., 20.}, {7., 300.}};
+				for (int32 i = 0; i < Points.Num(); i++)
+				{
+					QueryPoints.Add(Points[i]);
+					QueryPoints.Add(Points[i] + FVector2D{0.3, -0.7});
+				}
+
+				for (const FVector2D& Each : QueryPoints)
+				{
+					TArray<int32> Near;
+					SegmentArrayKernels::ForEachSegmentNear(SoA, bLoop, Each, [&](int32 SegmentIndex) { Near.Add(SegmentIndex); });
+
+					// FindClosestPointTo처럼 거리의 제곱을 float로 비교했을 때 가장 가까운 Segment는 모두 후보에 있어야 함
+					float ShortestDistanceSquared = TNumericLimits<float>::Max();
+					for (int32 i = 0; i < SegmentCount; i++)
+					{
+						ShortestDistanceSquared = FMath::Min(ShortestDistanceSquared,
+							static_cast<float>(ScalarSquaredDistance(Points[i], Points[(i + 1) % Points.Num()], Each)));
+					}
+
+					for (int32 i = 0; i < SegmentCount; i++)
+					{
+						const float DistanceSquared = static_cast<float>(ScalarSquaredDistance(Points[i], Points[(i + 1) % Points.Num()], Each));
+						if (DistanceSquared == ShortestDistanceSquared)
+						{
+							TestTrue(TEXT("TestCase 4: 가장 가까운 Segment는 후보에 있음"), Near.Contains(i));
+						}
+					}
+
+					for (int32 i = 0; i < Near.Num(); i++)
+					{
+						TestTrue(TEXT("TestCase 4: 후보는 Segment 범위 안에 있음"), Near[i] >= 0 && Near[i] < SegmentCount);
+						TestTrue(TEXT("TestCase 4: 후보는 오름차순"), i == 0 || Near[i - 1] < Near[i]);
+					}
+				}
+			}
+		}
+	}
+
+	return true;
+}
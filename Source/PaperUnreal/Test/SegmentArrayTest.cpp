@@ -1,10 +1,15 @@
-﻿#include "Misc/AutomationTest.h"
+﻿#include "TestBoundaryShapes.h"
+#include "Misc/AutomationTest.h"
 #include "PaperUnreal/AreaTracer/SegmentArray.h"
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(SegmentArrayTest, "PaperUnreal.PaperUnreal.Test.SegmentArrayTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
 
 bool SegmentArrayTest::RunTest(const FString& Parameters)
 {
+	using TestBoundaryShapes::MakeCircle;
+	using TestBoundaryShapes::MakeGear;
+	using TestBoundaryShapes::MakeWavyCircle;
+
 	const auto TestPointsEqual = [&](auto Text, const auto& Points0, const auto& Points1)
 	{
 		if (!TestEqual(Text, Points0.Num(), Points1.Num()))
@@ -501,6 +506,546 @@ bool SegmentArrayTest::RunTest(const FString& Parameters)
 			TestEqual(TEXT("TestCase 10"), Results2.Num(), 0);
 		}
 	}
+
+	{
+		// 공간 인덱스가 만들어질 만큼 큰 배열에서 쿼리 결과가 모든 Segment를 훑은 결과와 같은지 확인
+		const TArray<FVector2D> VertexPositions = MakeGear(FVector2D::ZeroVector, 100., 256);
+
+		FLoopedSegmentArray2D SegmentArray{VertexPositions};
+
+		const auto TestQueries = [&](auto Text)
+		{
+			for (int32 i = 0; i < 32; i++)
+			{
+				const FVector2D Point{-120. + 7.5 * i, 50. - 3. * i};
+				const UE::Geometry::FSegment2d Segment{Point, FVector2D::ZeroVector};
+
+				float ShortestDistance = TNumericLimits<float>::Max();
+				int32 ClosestSegmentIndex = INDEX_NONE;
+				TArray<int32> IntersectingSegmentIndices;
+				for (int32 j = 0; j < SegmentArray.SegmentCount(); j++)
+				{
+					const float Distance = SegmentArray[j].Perp(Point).Length();
+					if (Distance < ShortestDistance)
+					{
+						ShortestDistance = Distance;
+						ClosestSegmentIndex = j;
+					}
+
+					if (SegmentArray[j].Intersects(Segment))
+					{
+						IntersectingSegmentIndices.Add(j);
+					}
+				}
+
+				TestEqual(Text, SegmentArray.FindClosestPointTo(Point).SegmentIndex, ClosestSegmentIndex);
+
+				const TArray<FLoopedSegmentArray2D::FIntersection> Intersections = SegmentArray.FindAllIntersections(Segment);
+				if (TestEqual(Text, Intersections.Num(), IntersectingSegmentIndices.Num()))
+				{
+					for (int32 j = 0; j < Intersections.Num(); j++)
+					{
+						TestEqual(Text, Intersections[j].SegmentIndex, IntersectingSegmentIndices[j]);
+					}
+				}
+
+				const TOptional<FLoopedSegmentArray2D::FIntersection> FirstIntersection = SegmentArray.FindIntersection(Segment);
+				TestEqual(Text, FirstIntersection ? FirstIntersection->SegmentIndex : INDEX_NONE,
+					IntersectingSegmentIndices.IsEmpty() ? INDEX_NONE : IntersectingSegmentIndices[0]);
+			}
+		};
+
+		TestQueries(TEXT("TestCase 11: 큰 배열에서의 쿼리"));
+
+		SegmentArray.SetPoint(10, {0., 0.});
+		SegmentArray.AddPoint({95., -5.});
+		TestQueries(TEXT("TestCase 11: 점을 수정하고 추가한 후의 쿼리"));
+
+		SegmentArray.RemovePoints(100, 120);
+		TestQueries(TEXT("TestCase 11: 점을 제거한 후의 쿼리"));
+	}
+
+	{
+		const TArray<FVector2D> VertexPositions
+		{
+			{0.f, 0.f},
+			{10.f, 0.f},
+			{10.f, 10.f},
+			{5.f, 15.f},
+			{0.f, 10.f},
+		};
+
+		const TArray<FVector2D> Points
+		{
+			{5.f, 5.f},
+			{-1.f, 15.f},
+			{-1.f, 10.f},
+			{-1.f, 0.f},
+			{5.f, 15.f},
+			{0.f, 5.f},
+			{5.f, 0.f},
+			{2.f, 10.f},
+			{11.f, 5.f},
+		};
+
+		const TArray<bool> Expected{true, false, false, false, true, true, true, true, false};
+
+		FLoopedSegmentArray2D SegmentArray{VertexPositions};
+		for (int32 i = 0; i < Points.Num(); i++)
+		{
+			TestEqual(TEXT("TestCase 12: 꼭짓점이나 변과 같은 높이의 점"), SegmentArray.IsInside(Points[i]), Expected[i]);
+		}
+
+		TArray<bool> Results;
+		Results.SetNum(Points.Num());
+		SegmentArray.IsInside(Points, Results);
+		for (int32 i = 0; i < Points.Num(); i++)
+		{
+			TestEqual(TEXT("TestCase 12: 여러 점을 한 번에 검사"), Results[i], Expected[i]);
+		}
+	}
+
+	{
+		FLoopedSegmentArray2D SegmentArray{
+			{
+				{-1.f, -1.f},
+				{1.f, -1.f},
+				{1.f, 1.f},
+				{-1.f, 1.f},
+			}
+		};
+
+		// 저장해둔 넓이와 Bounding Box가 처음부터 다시 계산한 값과 같은지 확인
+		const auto TestCachedProperties = [&](auto Text)
+		{
+			const FLoopedSegmentArray2D Fresh{SegmentArray.GetPoints()};
+			TestNearlyEqual(Text, SegmentArray.CalculateSignedArea(), Fresh.CalculateSignedArea());
+			TestTrue(Text, SegmentArray.CalculateBoundingBox().Min.Equals(Fresh.CalculateBoundingBox().Min));
+			TestTrue(Text, SegmentArray.CalculateBoundingBox().Max.Equals(Fresh.CalculateBoundingBox().Max));
+		};
+
+		TestNearlyEqual(TEXT("TestCase 13"), SegmentArray.CalculateArea(), 4.f);
+		TestTrue(TEXT("TestCase 13"), SegmentArray.IsClockwise());
+
+		SegmentArray.AddPoint({-2.f, 0.f});
+		TestCachedProperties(TEXT("TestCase 13: AddPoint"));
+
+		SegmentArray.SetPoint(0, {-3.f, -3.f});
+		TestCachedProperties(TEXT("TestCase 13: SetPoint"));
+
+		SegmentArray.InsertPoints(2, {{2.f, -1.f}, {2.f, 0.f}});
+		TestCachedProperties(TEXT("TestCase 13: InsertPoints"));
+
+		SegmentArray.ReplacePoints(5, 1, {{-2.f, 2.f}});
+		TestCachedProperties(TEXT("TestCase 13: ReplacePoints"));
+
+		SegmentArray.RemovePoints(1, 2);
+		TestCachedProperties(TEXT("TestCase 13: RemovePoints"));
+
+		SegmentArray.ReverseVertexOrder();
+		TestCachedProperties(TEXT("TestCase 13: ReverseVertexOrder"));
+		TestFalse(TEXT("TestCase 13: ReverseVertexOrder"), SegmentArray.IsClockwise());
+	}
+
+	{
+		const TArray<FVector2D> VertexPositions
+		{
+			{0.f, 0.f},
+			{10.f, 0.f},
+			{10.f, 10.f},
+			{0.f, 10.f},
+		};
+
+		// 영역을 세 섬으로 쪼개는 Path, 가운데 섬이 가장 넓지만 Path의 방향상 남을 수 있는 섬은 양 옆의 섬뿐임
+		const TArray<FVector2D> Path
+		{
+			{2.f, -1.f},
+			{2.f, 11.f},
+			{7.f, 11.f},
+			{7.f, -1.f},
+		};
+
+		const TArray<FVector2D> Difference
+		{
+			{10.f, 0.f},
+			{10.f, 10.f},
+			{7.f, 10.f},
+			{7.f, 0.f},
+		};
+
+		FLoopedSegmentArray2D SegmentArray{VertexPositions};
+		TArray<FLoopedSegmentArray2D> DiscardedIslands;
+		RETURN_IF_FALSE(TestTrue(TEXT("TestCase 14: 버려진 섬을 반환하는 Difference"), SegmentArray.Difference(Path, &DiscardedIslands)));
+		TestPointsEqual(TEXT("TestCase 14: 버려진 섬을 반환하는 Difference"), SegmentArray.GetPoints(), Difference);
+		RETURN_IF_FALSE(TestEqual(TEXT("TestCase 14: 버려진 섬을 반환하는 Difference"), DiscardedIslands.Num(), 2));
+
+		DiscardedIslands.Sort([](const auto& Left, const auto& Right) { return Left.CalculateArea() < Right.CalculateArea(); });
+		TestNearlyEqual(TEXT("TestCase 14: 버려진 섬을 반환하는 Difference"), DiscardedIslands[0].CalculateArea(), 20.f);
+		TestNearlyEqual(TEXT("TestCase 14: 버려진 섬을 반환하는 Difference"), DiscardedIslands[1].CalculateArea(), 50.f);
+	}
+
+	{
+		const TArray<FVector2D> VertexPositions
+		{
+			{0.f, 0.f},
+			{10.f, 0.f},
+			{10.f, 10.f},
+			{0.f, 10.f},
+		};
+
+		// 영역 안쪽을 지나는 두 부분이 서로 교차하므로 섬을 하나씩 만들어보는 방법으로 잘림
+		const TArray<FVector2D> Path
+		{
+			{2.f, -1.f},
+			{2.f, 3.f},
+			{8.f, 11.f},
+			{3.f, 11.f},
+			{3.f, 7.f},
+			{8.f, -1.f},
+		};
+
+		FLoopedSegmentArray2D SegmentArray{VertexPositions};
+		TArray<FLoopedSegmentArray2D> DiscardedIslands;
+		RETURN_IF_FALSE(TestTrue(TEXT("TestCase 14: 서로 교차하는 Cut으로 섬을 버리는 Difference"), SegmentArray.Difference(Path, &DiscardedIslands)));
+		RETURN_IF_FALSE(TestFalse(TEXT("TestCase 14: 서로 교차하는 Cut으로 섬을 버리는 Difference"), DiscardedIslands.IsEmpty()));
+
+		double DiscardedArea = 0.;
+		for (const FLoopedSegmentArray2D& Each : DiscardedIslands)
+		{
+			TestTrue(TEXT("TestCase 14: 서로 교차하는 Cut으로 섬을 버리는 Difference"), Each.CalculateArea() > 0.);
+			DiscardedArea += Each.CalculateArea();
+		}
+		TestNearlyEqual(TEXT("TestCase 14: 서로 교차하는 Cut으로 섬을 버리는 Difference"), SegmentArray.CalculateArea() + DiscardedArea, 100.);
+	}
+
+	{
+		const FLoopedSegmentArray2D SegmentArray{
+			{
+				{0.f, 0.f},
+				{10.f, 0.f},
+				{10.f, 10.f},
+				{0.f, 10.f},
+			}
+		};
+
+		// 영역을 여러 번 드나드는 Path, 교차지점은 경계의 Segment 순서가 아니라 Path를 따라가는 순서로 정렬되어야 함
+		const FSegmentArray2D Path{
+			{
+				{-5.f, 5.f},
+				{15.f, 5.f},
+				{5.f, 13.f},
+				{5.f, -5.f},
+			}
+		};
+
+		const TArray<FVector2D> Expected
+		{
+			{0.f, 5.f},
+			{10.f, 5.f},
+			{10.f, 9.f},
+			{8.75f, 10.f},
+			{5.f, 10.f},
+			{5.f, 0.f},
+		};
+
+		const auto Intersections = SegmentArray.FindAllIntersectionsAlong(Path);
+		TArray<FVector2D> IntersectionPoints;
+		for (const auto& Each : Intersections)
+		{
+			IntersectionPoints.Add(Each.Point);
+		}
+
+		TestPointsEqual(TEXT("TestCase 15: Path를 따라 정렬된 교차지점"), IntersectionPoints, Expected);
+	}
+
+	{
+		// 각 변에 거의 일직선인 점들이 잔뜩 있는 정사각형
+		TArray<FVector2D> VertexPositions;
+		for (int32 i = 0; i < 10; i++)
+		{
+			const float Jitter = i % 2 == 0 ? 0.f : 0.01f;
+			VertexPositions.Add({static_cast<float>(i), Jitter});
+		}
+		for (int32 i = 0; i < 10; i++)
+		{
+			VertexPositions.Add({10.f, static_cast<float>(i)});
+		}
+		for (int32 i = 0; i < 10; i++)
+		{
+			VertexPositions.Add({10.f - i, 10.f});
+		}
+		for (int32 i = 0; i < 10; i++)
+		{
+			VertexPositions.Add({0.f, 10.f - i});
+		}
+
+		const TArray<FVector2D> Simplified
+		{
+			{0.f, 0.f},
+			{10.f, 0.f},
+			{10.f, 10.f},
+			{0.f, 10.f},
+		};
+
+		FLoopedSegmentArray2D SegmentArray{VertexPositions};
+		TestEqual(TEXT("TestCase 16: Simplify"), SegmentArray.Simplify(0.1f), 36);
+		TestPointsEqual(TEXT("TestCase 16: Simplify"), SegmentArray.GetPoints(), Simplified);
+		TestNearlyEqual(TEXT("TestCase 16: Simplify"), SegmentArray.CalculateArea(), 100.f);
+		TestEqual(TEXT("TestCase 16: 더 이상 제거할 점이 없는 Simplify"), SegmentArray.Simplify(0.1f), 0);
+	}
+
+	{
+		// 안쪽으로 깊게 파인 홈이 있는 모양, 오차 제한 없이 점을 줄여도 홈의 양쪽 벽이 서로 교차하면 안 됨
+		const TArray<FVector2D> VertexPositions
+		{
+			{0.f, 0.f},
+			{10.f, 0.f},
+			{10.f, 10.f},
+			{5.5f, 10.f},
+			{5.5f, 1.f},
+			{5.f, 0.5f},
+			{4.5f, 1.f},
+			{4.5f, 10.f},
+			{0.f, 10.f},
+		};
+
+		FLoopedSegmentArray2D SegmentArray{VertexPositions};
+		SegmentArray.Simplify(100.f, 4);
+
+		for (int32 i = 0; i < SegmentArray.SegmentCount(); i++)
+		{
+			for (int32 j = i + 2; j < SegmentArray.SegmentCount(); j++)
+			{
+				if (i == 0 && j == SegmentArray.SegmentCount() - 1)
+				{
+					continue;
+				}
+
+				TestFalse(TEXT("TestCase 17: 스스로 교차하지 않는 Simplify"), SegmentArray[i].Intersects(SegmentArray[j]).IsSet());
+			}
+		}
+	}
+
+	{
+		// (10, 0.2)는 오차가 가장 작지만 삼각형 안에 (10, 0.1)이 있어서 제거할 수 없다가 (10, 0.1)이 제거되면 제거할 수 있게 됨
+		const TArray<FVector2D> VertexPositions
+		{
+			{0.f, 0.f},
+			{10.f, 0.2f},
+			{20.f, 0.f},
+			{20.f, -10.f},
+			{11.f, -10.f},
+			{11.f, -0.5f},
+			{10.f, 0.1f},
+			{9.f, -0.5f},
+			{9.f, -10.f},
+			{0.f, -10.f},
+		};
+
+		const TArray<FVector2D> Simplified
+		{
+			{0.f, 0.f},
+			{20.f, 0.f},
+			{20.f, -10.f},
+			{11.f, -10.f},
+			{11.f, -0.5f},
+			{9.f, -0.5f},
+			{9.f, -10.f},
+			{0.f, -10.f},
+		};
+
+		FLoopedSegmentArray2D SegmentArray{VertexPositions};
+		TestEqual(TEXT("TestCase 17: 막고 있던 점이 제거된 후의 Simplify"), SegmentArray.Simplify(0.7f), 2);
+		TestPointsEqual(TEXT("TestCase 17: 막고 있던 점이 제거된 후의 Simplify"), SegmentArray.GetPoints(), Simplified);
+	}
+
+	{
+		// 점을 여러 번 이어서 제거해도 원래 점들은 단순화된 경계에서 MaxError보다 멀어지지 않음
+		const TArray<FVector2D> VertexPositions = MakeWavyCircle(FVector2D::ZeroVector, 100., 3., 12, 1000);
+
+		FLoopedSegmentArray2D SegmentArray{VertexPositions};
+		TestTrue(TEXT("TestCase 17: 오차 제한 안에서의 Simplify"), SegmentArray.Simplify(1.f) > 0);
+
+		for (const FVector2D& Each : VertexPositions)
+		{
+			const FLoopedSegmentArray2D::FIntersection Closest = SegmentArray.FindClosestPointTo(Each);
+			TestTrue(TEXT("TestCase 17: 오차 제한 안에서의 Simplify"),
+				FVector2D::Distance(Closest.Location(SegmentArray), Each) <= 1. + UE_KINDA_SMALL_NUMBER);
+		}
+	}
+
+	{
+		FLoopedSegmentArray2D SegmentArray{{{0.f, 0.f}, {10.f, 0.f}, {10.f, 10.f}, {0.f, 10.f}}};
+
+		TestFalse(TEXT("TestCase 18: 반경 밖의 점"), SegmentArray.FindClosestPointWithin({5.f, -1.f}, 0.5).IsSet());
+
+		const TOptional<FLoopedSegmentArray2D::FIntersection> Within = SegmentArray.FindClosestPointWithin({5.f, -1.f}, 2.);
+		if (TestTrue(TEXT("TestCase 18: 반경 안의 점"), Within.IsSet()))
+		{
+			TestEqual(TEXT("TestCase 18: 반경 안의 점"), Within->SegmentIndex, 0);
+			TestNearlyEqual(TEXT("TestCase 18: 반경 안의 점"), Within->Alpha, 0.5f);
+		}
+
+		const TArray<FLoopedSegmentArray2D::FIntersection> Closest = SegmentArray.FindClosestPointsTo({8.f, 5.f}, 3);
+		if (TestEqual(TEXT("TestCase 18: 가까운 순서"), Closest.Num(), 3))
+		{
+			TestEqual(TEXT("TestCase 18: 가까운 순서"), Closest[0].SegmentIndex, 1);
+			TestEqual(TEXT("TestCase 18: 가까운 순서"), Closest[1].SegmentIndex, 0);
+			TestEqual(TEXT("TestCase 18: 가까운 순서"), Closest[2].SegmentIndex, 2);
+		}
+
+		TestEqual(TEXT("TestCase 18: Segment 개수보다 많이 요청"), SegmentArray.FindClosestPointsTo({8.f, 5.f}, 10).Num(), 4);
+	}
+
+	{
+		// 공간 인덱스가 만들어질 만큼 큰 배열에서 반경 쿼리와 가까운 N개 쿼리가 모든 Segment를 훑은 결과와 같은지 확인
+		const TArray<FVector2D> VertexPositions = MakeGear(FVector2D::ZeroVector, 100., 256);
+
+		const FLoopedSegmentArray2D SegmentArray{VertexPositions};
+
+		for (int32 i = 0; i < 32; i++)
+		{
+			const FVector2D Point{-120. + 7.5 * i, 50. - 3. * i};
+
+			TArray<TPair<float, int32>> Expected;
+			for (int32 j = 0; j < SegmentArray.SegmentCount(); j++)
+			{
+				Expected.Emplace(static_cast<float>(SegmentArray.GetRawSegment(j).SquaredDistanceTo(Point)), j);
+			}
+			Expected.Sort([](const TPair<float, int32>& Left, const TPair<float, int32>& Right)
+			{
+				return Left.Key != Right.Key ? Left.Key < Right.Key : Left.Value < Right.Value;
+			});
+
+			const TArray<FLoopedSegmentArray2D::FIntersection> Closest = SegmentArray.FindClosestPointsTo(Point, 8);
+			if (TestEqual(TEXT("TestCase 18: 큰 배열에서 가까운 N개"), Closest.Num(), 8))
+			{
+				for (int32 j = 0; j < Closest.Num(); j++)
+				{
+					TestEqual(TEXT("TestCase 18: 큰 배열에서 가까운 N개"), Closest[j].SegmentIndex, Expected[j].Value);
+				}
+			}
+
+			const double Radius = 5.;
+			const TOptional<FLoopedSegmentArray2D::FIntersection> Within = SegmentArray.FindClosestPointWithin(Point, Radius);
+			TestEqual(TEXT("TestCase 18: 큰 배열에서 반경 쿼리"), Within ? Within->SegmentIndex : INDEX_NONE,
+				Expected[0].Key <= Radius * Radius ? Expected[0].Value : INDEX_NONE);
+		}
+	}
+
+	{
+		// 공간 인덱스를 만든 후에 모양이 바뀐 Segment는 인덱스가 두 번 방문하지만 결과에는 한 번만 나와야 함
+		FLoopedSegmentArray2D SegmentArray{MakeCircle(FVector2D::ZeroVector, 100., 256)};
+		SegmentArray.WarmCaches();
+		SegmentArray.SetPoint(64, {0., -95.});
+
+		const FVector2D Point{0., -90.};
+		TArray<TPair<float, int32>> Expected;
+		for (int32 j = 0; j < SegmentArray.SegmentCount(); j++)
+		{
+			Expected.Emplace(static_cast<float>(SegmentArray.GetRawSegment(j).SquaredDistanceTo(Point)), j);
+		}
+		Expected.Sort([](const TPair<float, int32>& Left, const TPair<float, int32>& Right)
+		{
+			return Left.Key != Right.Key ? Left.Key < Right.Key : Left.Value < Right.Value;
+		});
+
+		const TArray<FLoopedSegmentArray2D::FIntersection> Closest = SegmentArray.FindClosestPointsTo(Point, 4);
+		if (TestEqual(TEXT("TestCase 18: 점을 수정한 후 가까운 N개"), Closest.Num(), 4))
+		{
+			for (int32 j = 0; j < Closest.Num(); j++)
+			{
+				TestEqual(TEXT("TestCase 18: 점을 수정한 후 가까운 N개"), Closest[j].SegmentIndex, Expected[j].Value);
+			}
+		}
+	}
+
+	{
+		const TArray<FVector2D> VertexPositions
+		{
+			{0.f, 0.f},
+			{10.f, 0.f},
+			{10.f, 10.f},
+			{0.f, 10.f},
+		};
+
+		const FLoopedSegmentArray2D Original{VertexPositions};
+		FLoopedSegmentArray2D Copy = Original;
+		TestTrue(TEXT("TestCase 19: 복사본은 점들을 공유함"), Copy.GetPoints().GetData() == Original.GetPoints().GetData());
+
+		Copy.SetPoint(0, {-1.f, -1.f});
+		TestTrue(TEXT("TestCase 19: 수정하면 공유를 끊음"), Copy.GetPoints().GetData() != Original.GetPoints().GetData());
+		TestPointsEqual(TEXT("TestCase 19: 원본은 그대로"), Original.GetPoints(), VertexPositions);
+		TestEqual(TEXT("TestCase 19: 수정된 복사본"), Copy.GetPoint(0), FVector2D{-1.f, -1.f});
+
+		FLoopedSegmentArray2D Replaced = Original;
+		Replaced.ReplacePoints(3, 0, TArray<FVector2D>{{0.f, 5.f}});
+		TestPointsEqual(TEXT("TestCase 19: 공유 중인 배열의 교체"), Replaced.GetPoints(), TArray<FVector2D>{{10.f, 0.f}, {10.f, 10.f}, {0.f, 5.f}});
+		TestPointsEqual(TEXT("TestCase 19: 원본은 그대로"), Original.GetPoints(), VertexPositions);
+		TestNearlyEqual(TEXT("TestCase 19: 공유 중인 배열의 교체"), Replaced.CalculateArea(), 50.f);
+	}
+
+	{
+		FSegmentArray2D Moved{TArray<FVector2D>{{0.f, 0.f}, {100.f, 0.f}, {100.f, 100.f}}};
+		Moved.CalculateBoundingBox();
+
+		const FSegmentArray2D Destination = MoveTemp(Moved);
+		TestEqual(TEXT("TestCase 20: 이동된 배열은 비어있음"), Moved.PointCount(), 0);
+
+		Moved.AddPoint({1.f, 1.f});
+		Moved.AddPoint({2.f, 3.f});
+		TestEqual(TEXT("TestCase 20: 이동된 배열의 Bounding Box"), Moved.CalculateBoundingBox(), FBox2D{FVector2D{1.f, 1.f}, FVector2D{2.f, 3.f}});
+		TestEqual(TEXT("TestCase 20: 이동받은 배열의 Bounding Box"), Destination.CalculateBoundingBox(), FBox2D{FVector2D{0.f, 0.f}, FVector2D{100.f, 100.f}});
+
+		FSegmentArray2D Assigned{TArray<FVector2D>{{5.f, 5.f}, {6.f, 6.f}}};
+		Assigned.CalculateBoundingBox();
+		Assigned = MoveTemp(Moved);
+		TestEqual(TEXT("TestCase 20: 이동 대입된 배열의 Bounding Box"), Assigned.CalculateBoundingBox(), FBox2D{FVector2D{1.f, 1.f}, FVector2D{2.f, 3.f}});
+
+		Moved.AddPoint({-4.f, 7.f});
+		TestEqual(TEXT("TestCase 20: 이동 대입 후 이동된 배열의 Bounding Box"), Moved.CalculateBoundingBox(), FBox2D{FVector2D{-4.f, 7.f}, FVector2D{-4.f, 7.f}});
+	}
+
+	{
+		// 경계 위에서 출발한 Path의 양 끝이 경계가 단순화되면서 경계 밖으로 0.5만큼 떨어진 상황
+		const TArray<FVector2D> VertexPositions
+		{
+			{0.f, 0.f},
+			{100.f, 0.f},
+			{100.f, 100.f},
+			{0.f, 100.f},
+		};
+
+		const FSegmentArray2D Path{
+			{
+				{50.f, -0.5f},
+				{50.f, -20.f},
+				{70.f, -20.f},
+				{70.f, -0.5f},
+			}
+		};
+
+		{
+			FLoopedSegmentArray2D SegmentArray{VertexPositions};
+			TestEqual(TEXT("TestCase 21: 경계에서 떨어진 Path의 Union"), SegmentArray.Union(Path).Num(), 0);
+		}
+
+		{
+			FLoopedSegmentArray2D SegmentArray{VertexPositions};
+			FSegmentArray2D AttachedPath = Path;
+			SegmentArray.AttachPathEnds(AttachedPath, 1.);
+			TestEqual(TEXT("TestCase 21: 경계에 이어붙인 Path"), AttachedPath.PointCount(), 6);
+			TestEqual(TEXT("TestCase 21: 경계에 이어붙인 Path의 Union"), SegmentArray.Union(AttachedPath).Num(), 1);
+			TestNearlyEqual(TEXT("TestCase 21: 경계에 이어붙인 Path의 Union"), SegmentArray.CalculateArea(), 10400.f, 0.1f);
+		}
+
+		{
+			const FLoopedSegmentArray2D SegmentArray{VertexPositions};
+			FSegmentArray2D AttachedPath = Path;
+			SegmentArray.AttachPathEnds(AttachedPath, 0.25);
+			TestEqual(TEXT("TestCase 21: MaxDistance보다 멀리 떨어진 Path"), AttachedPath.PointCount(), 4);
+		}
+	}
 	
 	return true;
 }
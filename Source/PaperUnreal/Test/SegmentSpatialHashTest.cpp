@@ -0,0 +1,77 @@
+#include "Misc/AutomationTest.h"
+#include "PaperUnreal/AreaTracer/SegmentSpatialHash.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(SegmentSpatialHashTest, "PaperUnreal.PaperUnreal.Test.SegmentSpatialHashTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool SegmentSpatialHashTest::RunTest(const FString& Parameters)
+{
+	{
+		TSegmentSpatialHash2D<int32> Hash{10.};
+		Hash.Add(0, 0, {{0., 0.}, {35., 0.}});
+		Hash.Add(0, 1, {{35., 0.}, {35., 35.}});
+		Hash.Add(1, 0, {{-5., 20.}, {50., 20.}});
+
+		TArray<TPair<int32, int32>> Found;
+		Hash.ForEachIntersecting({{20., -10.}, {40., 30.}}, [&](int32 Key, int32 SegmentIndex) { Found.Add({Key, SegmentIndex}); });
+		Found.Sort([](const auto& Left, const auto& Right) { return Left.Key != Right.Key ? Left.Key < Right.Key : Left.Value < Right.Value; });
+
+		// 여러 칸에 걸친 Segment도 한 번씩만 나와야 함
+		RETURN_IF_FALSE(TestEqual(TEXT("TestCase 1: 여러 칸에 걸친 Segment"), Found.Num(), 3));
+		TestTrue(TEXT("TestCase 1: 여러 칸에 걸친 Segment"), Found[0].Key == 0 && Found[0].Value == 0);
+		TestTrue(TEXT("TestCase 1: 여러 칸에 걸친 Segment"), Found[1].Key == 0 && Found[1].Value == 1);
+		TestTrue(TEXT("TestCase 1: 여러 칸에 걸친 Segment"), Found[2].Key == 1 && Found[2].Value == 0);
+
+		Hash.Remove(0);
+		Found.Empty();
+		Hash.ForEachIntersecting({{20., -10.}, {40., 30.}}, [&](int32 Key, int32 SegmentIndex) { Found.Add({Key, SegmentIndex}); });
+		RETURN_IF_FALSE(TestEqual(TEXT("TestCase 1: 주인 단위 제거"), Found.Num(), 1));
+		TestEqual(TEXT("TestCase 1: 주인 단위 제거"), Found[0].Key, 1);
+
+		Hash.Remove(1);
+		TestTrue(TEXT("TestCase 1: 모두 제거"), Hash.IsEmpty());
+	}
+
+	{
+		// 트레이서처럼 생긴 여러 개의 Path를 넣고 FindIntersection과 비교
+		TArray<FSegmentArray2D> Paths;
+		TSegmentSpatialHash2D<int32> Hash{50.};
+		for (int32 PathIndex = 0; PathIndex < 4; PathIndex++)
+		{
+			FSegmentArray2D& Path = Paths.AddDefaulted_GetRef();
+			for (int32 i = 0; i < 64; i++)
+			{
+				const double T = i * 0.1 + PathIndex;
+				Path.AddPoint({200. * FMath::Cos(T * 1.3 + PathIndex) + 7. * i, 200. * FMath::Sin(T * 0.7) - 3. * PathIndex * i});
+			}
+
+			for (int32 i = 0; i < Path.SegmentCount(); i++)
+			{
+				Hash.Add(PathIndex, i, Path.GetRawSegment(i));
+			}
+		}
+
+		int32 MismatchCount = 0;
+		for (int32 i = 0; i < 200; i++)
+		{
+			const FVector2D Start{300. * FMath::Cos(i * 0.37), 300. * FMath::Sin(i * 0.53)};
+			const FRawSegment2D Movement{Start, Start + FVector2D{FMath::Cos(i * 1.1), FMath::Sin(i * 1.1)} * (5. + i)};
+
+			TArray<int32> Counts;
+			Counts.SetNumZeroed(Paths.Num() * 64);
+			Hash.ForEachIntersecting(Movement, [&](int32 Key, int32 SegmentIndex) { Counts[Key * 64 + SegmentIndex]++; });
+
+			for (int32 PathIndex = 0; PathIndex < Paths.Num(); PathIndex++)
+			{
+				for (int32 j = 0; j < Paths[PathIndex].SegmentCount(); j++)
+				{
+					const int32 Expected = Paths[PathIndex].GetRawSegment(j).Intersects(Movement) ? 1 : 0;
+					MismatchCount += Counts[PathIndex * 64 + j] != Expected ? 1 : 0;
+				}
+			}
+		}
+
+		TestEqual(TEXT("TestCase 2: FindIntersection과 같은 결과"), MismatchCount, 0);
+	}
+
+	return true;
+}
@@ -0,0 +1,51 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+ * 테스트에서 영역 경계로 사용하는 다각형들을 만드는 함수들
+ *
+ * 모두 ResetToStartingBoundary와 같은 방향으로 점을 나열하며 첫 점은 Center에서 +X 방향에 있습니다.
+ */
+namespace TestBoundaryShapes
+{
+	/**
+	 * i번째 점을 Center에서 RadiusAt(i번째 점의 각도)만큼 떨어진 곳에 둔 다각형
+	 */
+	template <typename FuncType>
+	TArray<FVector2D> MakeRadial(const FVector2D& Center, int32 PointCount, const FuncType& RadiusAt)
+	{
+		TArray<FVector2D> Ret;
+		Ret.Reserve(PointCount);
+		for (int32 i = 0; i < PointCount; i++)
+		{
+			const double Angle = -2. * UE_PI * i / PointCount;
+			Ret.Add(Center + FVector2D{FMath::Cos(Angle), FMath::Sin(Angle)} * RadiusAt(Angle, i));
+		}
+		return Ret;
+	}
+
+	inline TArray<FVector2D> MakeCircle(const FVector2D& Center, double Radius, int32 PointCount)
+	{
+		return MakeRadial(Center, PointCount, [&](double, int32) { return Radius; });
+	}
+
+	/**
+	 * 점이 하나 걸러 하나씩 안쪽으로 들어간 톱니 모양, 점이 많아도 Simplify로 줄어들지 않음
+	 */
+	inline TArray<FVector2D> MakeGear(const FVector2D& Center, double Radius, int32 PointCount)
+	{
+		return MakeRadial(Center, PointCount, [&](double, int32 Index) { return Radius * (Index % 2 == 0 ? 1. : 0.8); });
+	}
+
+	/**
+	 * 반지름이 한 바퀴에 WaveCount번 Amplitude만큼 출렁이는 원
+	 */
+	inline TArray<FVector2D> MakeWavyCircle(const FVector2D& Center, double Radius, double Amplitude, int32 WaveCount, int32 PointCount)
+	{
+		return MakeRadial(Center, PointCount, [&](double Angle, int32) { return Radius + Amplitude * FMath::Sin(Angle * WaveCount); });
+	}
+}
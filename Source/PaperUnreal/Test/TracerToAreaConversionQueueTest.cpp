@@ -0,0 +1,128 @@
+#include "TestBoundaryShapes.h"
+#include "Misc/AutomationTest.h"
+#include "PaperUnreal/AreaTracer/TracerToAreaConversionQueue.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(TracerToAreaConversionQueueTest, "PaperUnreal.PaperUnreal.Test.TracerToAreaConversionQueueTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool TracerToAreaConversionQueueTest::RunTest(const FString& Parameters)
+{
+	// UTracerToAreaConverterComponent처럼 예약된 변환을 바로 영역에 적용하고 적용한 횟수를 셈
+	struct FConverter
+	{
+		FLoopedSegmentArray2D Area{TestBoundaryShapes::MakeCircle({0., 0.}, 100., 64)};
+		FSegmentArray2D RunningPath;
+		FTracerToAreaConversionQueue Queue;
+		int32 ConversionCount = 0;
+
+		// 다른 확장이 진행 중이면 예약만 하고 변환은 확장이 끝난 후에 함
+		bool bExpansionPending = false;
+
+		void ConvertPendingPaths()
+		{
+			while (TOptional<FSegmentArray2D> Path = Queue.Pop(RunningPath, Area))
+			{
+				Area.Union(MoveTemp(*Path));
+				ConversionCount++;
+			}
+		}
+
+		void AddPoint(const FVector2D& Point)
+		{
+			RunningPath.AddPoint(Point);
+			if (Queue.OnRunningPathHeadMoved(RunningPath, Area) && !bExpansionPending)
+			{
+				ConvertPendingPaths();
+			}
+		}
+
+		void Complete()
+		{
+			// 트레이서는 영역에 들어오면 끝을 경계에 붙이고 완성됨
+			RunningPath.SetPoint(-1, Area.FindClosestPointTo(RunningPath.GetPoint(-1)).Location(Area));
+			if (Queue.OnRunningPathHeadMoved(RunningPath, Area))
+			{
+				ConvertPendingPaths();
+			}
+
+			Queue.OnPathCompleted(RunningPath);
+			RunningPath.Empty();
+			ConvertPendingPaths();
+		}
+	};
+
+	{
+		// 영역 밖으로 나갔다가 다시 들어오면 들어올 때 한 번만 변환함
+		FConverter Converter;
+		Converter.AddPoint(Converter.Area.GetPoint(0));
+		Converter.AddPoint({150., 0.});
+		Converter.AddPoint({150., 60.});
+		TestEqual(TEXT("TestCase 1: 나갔다가 다시 들어옴"), Converter.ConversionCount, 0);
+
+		Converter.AddPoint({60., 60.});
+		TestEqual(TEXT("TestCase 1: 나갔다가 다시 들어옴"), Converter.ConversionCount, 1);
+		const double ExpandedArea = Converter.Area.CalculateArea();
+		TestTrue(TEXT("TestCase 1: 나갔다가 다시 들어옴"), ExpandedArea > UE_PI * 100. * 100.);
+
+		Converter.Complete();
+		TestEqual(TEXT("TestCase 1: 완성된 트레이서는 다시 변환하지 않음"), Converter.ConversionCount, 1);
+		TestNearlyEqual(TEXT("TestCase 1: 완성된 트레이서는 다시 변환하지 않음"), Converter.Area.CalculateArea(), ExpandedArea);
+	}
+
+	{
+		// 영역을 가로질러 다시 나간 뒤에 들어오면 가로지른 이후의 부분만 들어올 때 변환함
+		FConverter Converter;
+		Converter.AddPoint(Converter.Area.GetPoint(0));
+		Converter.AddPoint({150., 0.});
+		Converter.AddPoint({150., 80.});
+		Converter.AddPoint({-100., 80.});
+		TestEqual(TEXT("TestCase 2: 가로질러 다시 나감"), Converter.ConversionCount, 1);
+
+		Converter.AddPoint({-120., 0.});
+		Converter.AddPoint({-50., 0.});
+		TestEqual(TEXT("TestCase 2: 다시 들어옴"), Converter.ConversionCount, 2);
+
+		Converter.Complete();
+		TestEqual(TEXT("TestCase 2: 완성된 트레이서는 다시 변환하지 않음"), Converter.ConversionCount, 2);
+		TestTrue(TEXT("TestCase 2: 다시 들어옴"), Converter.Area.IsInside(FVector2D{-105., 40.}));
+		TestTrue(TEXT("TestCase 2: 다시 들어옴"), Converter.Area.IsInside(FVector2D{140., 40.}));
+	}
+
+	{
+		// 끝 Segment가 경계를 가로지르는 것을 놓쳐도 완성될 때 전체를 변환함
+		FConverter Converter;
+		Converter.RunningPath.AddPoint(Converter.Area.GetPoint(0));
+		Converter.RunningPath.AddPoint({150., 0.});
+		Converter.RunningPath.AddPoint({150., 60.});
+		Converter.RunningPath.AddPoint({60., 60.});
+
+		Converter.Queue.OnPathCompleted(Converter.RunningPath);
+		Converter.ConvertPendingPaths();
+		TestEqual(TEXT("TestCase 3: 가로지르지 않고 완성됨"), Converter.ConversionCount, 1);
+		TestTrue(TEXT("TestCase 3: 가로지르지 않고 완성됨"), Converter.Area.IsInside(FVector2D{140., 30.}));
+	}
+
+	{
+		// 다른 확장이 진행 중일 때 가로지르면 변환을 꺼낼 때 Path가 더 길어져 있어도 가로지른 Segment까지만 변환함
+		FConverter Converter;
+		Converter.AddPoint(Converter.Area.GetPoint(0));
+		Converter.AddPoint({150., 0.});
+		Converter.AddPoint({150., 80.});
+
+		Converter.bExpansionPending = true;
+		Converter.AddPoint({-100., 80.});
+		Converter.AddPoint({-120., 0.});
+		TestEqual(TEXT("TestCase 4: 확장 중에 가로지름"), Converter.ConversionCount, 0);
+
+		Converter.bExpansionPending = false;
+		Converter.ConvertPendingPaths();
+		TestEqual(TEXT("TestCase 4: 확장이 끝난 후 변환"), Converter.ConversionCount, 1);
+		TestTrue(TEXT("TestCase 4: 확장이 끝난 후 변환"), Converter.Area.IsInside(FVector2D{140., 40.}));
+		TestFalse(TEXT("TestCase 4: 가로지른 이후의 부분은 변환하지 않음"), Converter.Area.IsInside(FVector2D{-105., 40.}));
+
+		Converter.AddPoint({-50., 0.});
+		TestEqual(TEXT("TestCase 4: 다시 들어옴"), Converter.ConversionCount, 2);
+		TestTrue(TEXT("TestCase 4: 다시 들어옴"), Converter.Area.IsInside(FVector2D{-105., 40.}));
+	}
+
+	return true;
+}